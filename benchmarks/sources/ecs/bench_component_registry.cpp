@@ -0,0 +1,154 @@
+/*
+ Copyright (c) 2026 ETIB Corporation
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy of
+ this software and associated documentation files (the "Software"), to deal in
+ the Software without restriction, including without limitation the rights to
+ use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ of the Software, and to permit persons to whom the Software is furnished to do
+ so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in all
+ copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ SOFTWARE.
+ */
+
+#include <map>
+#include <memory>
+#include <typeindex>
+#include <utility>
+
+#include <benchmark/benchmark.h>
+
+#include <guillaume/ecs/component_registry.hpp>
+
+namespace guillaume::ecs::benchmarks
+{
+
+	/**
+	 * @brief Distinct component types standing in for the built-in ones.
+	 * @tparam Index Discriminator making each instantiation a new type.
+	 */
+	template<std::size_t Index> class BenchComponent: public Component
+	{
+		public:
+		int value { static_cast<int>(Index) };
+	};
+
+	constexpr std::size_t EntityCount = 2048;
+
+	/**
+	 * @brief Fill a registry with nine component types for every entity.
+	 * @param registry The registry to fill.
+	 */
+	static void fillRegistry(ComponentRegistry &registry)
+	{
+		for (Entity::Identifier identifier = 1; identifier <= EntityCount;
+			 ++identifier) {
+			registry.registerComponentsForEntity<
+				BenchComponent<0>, BenchComponent<1>, BenchComponent<2>,
+				BenchComponent<3>, BenchComponent<4>, BenchComponent<5>,
+				BenchComponent<6>, BenchComponent<7>, BenchComponent<8>>(
+				identifier);
+		}
+	}
+
+	using LegacyStorages =
+		std::map<std::type_index, std::unique_ptr<IComponentStorage>>;
+
+	/**
+	 * @brief Fill a type_index keyed map the way ComponentRegistry used to.
+	 * @param storages The map to fill.
+	 */
+	template<std::size_t... Indices> static void
+		addLegacyStorages(LegacyStorages &storages,
+						  std::index_sequence<Indices...>)
+	{
+		(storages.emplace(
+			 typeid(BenchComponent<Indices>),
+			 std::make_unique<ComponentStorage<BenchComponent<Indices>>>()),
+		 ...);
+	}
+
+	/**
+	 * @brief Storage lookup as done before storages were indexed by
+	 * ComponentTypeId: one std::map<std::type_index> search per access.
+	 */
+	static void BM_TypeIndexMapStorageLookup(benchmark::State &state)
+	{
+		LegacyStorages storages;
+		addLegacyStorages(storages, std::make_index_sequence<9>());
+		for (Entity::Identifier identifier = 1; identifier <= EntityCount;
+			 ++identifier) {
+			static_cast<ComponentStorage<BenchComponent<6>> &>(
+				*storages.at(typeid(BenchComponent<6>)))
+				.emplace(identifier);
+		}
+
+		for (auto _: state) {
+			int sum = 0;
+			for (Entity::Identifier identifier = 1; identifier <= EntityCount;
+				 ++identifier) {
+				auto iterator = storages.find(typeid(BenchComponent<6>));
+				auto &storage =
+					static_cast<ComponentStorage<BenchComponent<6>> &>(
+						*iterator->second);
+				sum += storage.find(identifier)->value;
+			}
+			benchmark::DoNotOptimize(sum);
+		}
+		state.SetItemsProcessed(state.iterations() * EntityCount);
+	}
+	BENCHMARK(BM_TypeIndexMapStorageLookup);
+
+	/**
+	 * @brief Storage lookup through the flat ComponentTypeId-indexed array.
+	 */
+	static void BM_ComponentRegistryGetComponent(benchmark::State &state)
+	{
+		ComponentRegistry registry;
+		fillRegistry(registry);
+
+		for (auto _: state) {
+			int sum = 0;
+			for (Entity::Identifier identifier = 1; identifier <= EntityCount;
+				 ++identifier) {
+				sum += registry.getComponent<BenchComponent<6>>(identifier)
+						   .value;
+			}
+			benchmark::DoNotOptimize(sum);
+		}
+		state.SetItemsProcessed(state.iterations() * EntityCount);
+	}
+	BENCHMARK(BM_ComponentRegistryGetComponent);
+
+	/**
+	 * @brief Presence check through the flat ComponentTypeId-indexed array.
+	 */
+	static void BM_ComponentRegistryHasComponent(benchmark::State &state)
+	{
+		ComponentRegistry registry;
+		fillRegistry(registry);
+		const ComponentRegistry &constRegistry = registry;
+
+		for (auto _: state) {
+			std::size_t count = 0;
+			for (Entity::Identifier identifier = 1; identifier <= EntityCount;
+				 ++identifier) {
+				count += constRegistry.hasComponent<BenchComponent<6>>(
+					identifier);
+			}
+			benchmark::DoNotOptimize(count);
+		}
+		state.SetItemsProcessed(state.iterations() * EntityCount);
+	}
+	BENCHMARK(BM_ComponentRegistryHasComponent);
+
+}	 // namespace guillaume::ecs::benchmarks
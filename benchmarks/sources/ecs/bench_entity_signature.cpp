@@ -0,0 +1,92 @@
+/*
+ Copyright (c) 2026 ETIB Corporation
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy of
+ this software and associated documentation files (the "Software"), to deal in
+ the Software without restriction, including without limitation the rights to
+ use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ of the Software, and to permit persons to whom the Software is furnished to do
+ so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in all
+ copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ SOFTWARE.
+ */
+
+#include <bitset>
+#include <cstddef>
+#include <random>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <guillaume/ecs/entity.hpp>
+
+namespace guillaume::ecs::benchmarks
+{
+
+	constexpr std::size_t SignatureCount = 4096;
+
+	/**
+	 * @brief Build entity signatures with a few components each.
+	 * @tparam TypeCount The number of bits in a signature.
+	 * @return Signatures with random bits set.
+	 */
+	template<std::size_t TypeCount>
+	static std::vector<std::bitset<TypeCount>> makeSignatures(void)
+	{
+		std::mt19937 generator(42);
+		std::uniform_int_distribution<std::size_t> distribution(0,
+																 TypeCount - 1);
+		std::vector<std::bitset<TypeCount>> signatures(SignatureCount);
+		for (auto &signature: signatures) {
+			for (std::size_t bit = 0; bit < 8; ++bit) {
+				signature.set(distribution(generator));
+			}
+		}
+		return signatures;
+	}
+
+	/**
+	 * @brief Match entity signatures against a system signature the way
+	 * EntityQuery::matches does.
+	 * @tparam TypeCount The number of bits in a signature.
+	 */
+	template<std::size_t TypeCount>
+	static void BM_SignatureMatch(benchmark::State &state)
+	{
+		const auto signatures = makeSignatures<TypeCount>();
+		std::bitset<TypeCount> systemSignature;
+		systemSignature.set(1);
+		systemSignature.set(TypeCount - 1);
+
+		for (auto _: state) {
+			std::size_t count = 0;
+			for (const auto &signature: signatures) {
+				count += (signature & systemSignature) == systemSignature;
+			}
+			benchmark::DoNotOptimize(count);
+		}
+		state.SetItemsProcessed(state.iterations() * SignatureCount);
+	}
+	BENCHMARK_TEMPLATE(BM_SignatureMatch, 64);
+	BENCHMARK_TEMPLATE(BM_SignatureMatch, 256);
+	BENCHMARK_TEMPLATE(BM_SignatureMatch, 1024);
+
+	/**
+	 * @brief Match with the configured Entity::Signature width.
+	 */
+	static void BM_EntitySignatureMatch(benchmark::State &state)
+	{
+		BM_SignatureMatch<MaxComponentTypes>(state);
+	}
+	BENCHMARK(BM_EntitySignatureMatch);
+
+}	 // namespace guillaume::ecs::benchmarks
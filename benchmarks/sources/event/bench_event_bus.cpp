@@ -0,0 +1,127 @@
+/*
+ Copyright (c) 2026 ETIB Corporation
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy of
+ this software and associated documentation files (the "Software"), to deal in
+ the Software without restriction, including without limitation the rights to
+ use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ of the Software, and to permit persons to whom the Software is furnished to do
+ so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in all
+ copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ SOFTWARE.
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <queue>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <guillaume/event/event_bus.hpp>
+#include <guillaume/event/event_subscriber.hpp>
+#include <utility/event/hand_motion_event.hpp>
+#include <utility/event/mouse_motion_event.hpp>
+
+namespace guillaume::event::benchmarks
+{
+
+	/**
+	 * @brief Mouse motion events per 60 Hz frame from a 1 kHz mouse.
+	 */
+	constexpr std::int64_t MouseEventsPerFrame = 17;
+
+	/**
+	 * @brief Hand motion events per 90 Hz frame: 26 joints for each hand.
+	 */
+	constexpr std::int64_t HandEventsPerFrame = 2 * 26;
+
+	/**
+	 * @brief Publish one frame of events through the bus and drain every
+	 * subscriber.
+	 *
+	 * Arguments: events per frame, subscribers.
+	 * @tparam EventType The published event type.
+	 */
+	template<utility::event::InheritFromEvent EventType>
+	static void BM_EventBusFanOut(benchmark::State &state)
+	{
+		const auto eventCount	   = static_cast<std::size_t>(state.range(0));
+		const auto subscriberCount = static_cast<std::size_t>(state.range(1));
+		EventBus eventBus;
+		std::vector<std::unique_ptr<EventSubscriber<EventType>>> subscribers;
+		for (std::size_t index = 0; index < subscriberCount; ++index) {
+			subscribers.push_back(
+				std::make_unique<EventSubscriber<EventType>>(eventBus));
+		}
+
+		for (auto _: state) {
+			for (std::size_t index = 0; index < eventCount; ++index) {
+				eventBus.publish(std::make_unique<EventType>());
+			}
+			for (auto &subscriber: subscribers) {
+				while (subscriber->hasPendingEvents()) {
+					benchmark::DoNotOptimize(subscriber->getNextEvent());
+				}
+			}
+		}
+		state.SetItemsProcessed(state.iterations()
+								* static_cast<std::int64_t>(eventCount));
+	}
+	BENCHMARK(BM_EventBusFanOut<utility::event::MouseMotionEvent>)
+		->Args({ MouseEventsPerFrame, 1 })
+		->Args({ MouseEventsPerFrame, 4 });
+	BENCHMARK(BM_EventBusFanOut<utility::event::HandMotionEvent>)
+		->Args({ HandEventsPerFrame, 1 })
+		->Args({ HandEventsPerFrame, 4 });
+
+	/**
+	 * @brief Same frame, giving each subscriber its own deep copy of every
+	 * event: the cost fan-out would have without shared events.
+	 *
+	 * Arguments: events per frame, subscribers.
+	 * @tparam EventType The published event type.
+	 */
+	template<utility::event::InheritFromEvent EventType>
+	static void BM_DeepCopyFanOut(benchmark::State &state)
+	{
+		const auto eventCount	   = static_cast<std::size_t>(state.range(0));
+		const auto subscriberCount = static_cast<std::size_t>(state.range(1));
+		std::vector<std::queue<std::unique_ptr<EventType>>> queues(
+			subscriberCount);
+
+		for (auto _: state) {
+			for (std::size_t index = 0; index < eventCount; ++index) {
+				const auto event = std::make_unique<EventType>();
+				for (auto &queue: queues) {
+					queue.push(std::make_unique<EventType>(*event));
+				}
+			}
+			for (auto &queue: queues) {
+				while (!queue.empty()) {
+					benchmark::DoNotOptimize(queue.front());
+					queue.pop();
+				}
+			}
+		}
+		state.SetItemsProcessed(state.iterations()
+								* static_cast<std::int64_t>(eventCount));
+	}
+	BENCHMARK(BM_DeepCopyFanOut<utility::event::MouseMotionEvent>)
+		->Args({ MouseEventsPerFrame, 1 })
+		->Args({ MouseEventsPerFrame, 4 });
+	BENCHMARK(BM_DeepCopyFanOut<utility::event::HandMotionEvent>)
+		->Args({ HandEventsPerFrame, 1 })
+		->Args({ HandEventsPerFrame, 4 });
+
+}	 // namespace guillaume::event::benchmarks
\ No newline at end of file
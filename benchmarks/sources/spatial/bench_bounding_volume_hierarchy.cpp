@@ -0,0 +1,145 @@
+/*
+ Copyright (c) 2026 ETIB Corporation
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy of
+ this software and associated documentation files (the "Software"), to deal in
+ the Software without restriction, including without limitation the rights to
+ use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ of the Software, and to permit persons to whom the Software is furnished to do
+ so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in all
+ copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ SOFTWARE.
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <random>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <guillaume/spatial/bounding_volume_hierarchy.hpp>
+
+namespace guillaume::spatial::benchmarks
+{
+
+	/**
+	 * @brief Rays cast per frame: the aim of both hands.
+	 */
+	constexpr std::size_t HandRays = 2;
+
+	/**
+	 * @brief Scatter panels in a room around the origin.
+	 * @param count The number of panels.
+	 * @return The panels.
+	 */
+	static std::vector<OrientedRectangle> scatterPanels(std::size_t count)
+	{
+		std::mt19937 generator(7);
+		std::uniform_real_distribution<float> coordinate(-20.0f, 20.0f);
+		std::vector<OrientedRectangle> panels;
+		panels.reserve(count);
+		for (std::size_t index = 0; index < count; ++index) {
+			panels.emplace_back(
+				utility::graphic::PositionF(coordinate(generator),
+											coordinate(generator),
+											coordinate(generator) - 30.0f),
+				utility::graphic::OrientationF(), 0.4f, 0.3f);
+		}
+		return panels;
+	}
+
+	/**
+	 * @brief Rays from the head towards the panels.
+	 * @param count The number of rays.
+	 * @return The rays.
+	 */
+	static std::vector<utility::graphic::RayF> aimRays(std::size_t count)
+	{
+		std::mt19937 generator(11);
+		std::uniform_real_distribution<float> component(-0.5f, 0.5f);
+		std::vector<utility::graphic::RayF> rays;
+		for (std::size_t index = 0; index < count; ++index) {
+			rays.emplace_back(
+				utility::graphic::PositionF(0.0f, 0.0f, 0.0f),
+				utility::math::Vector3F(
+					{ component(generator), component(generator), -1.0f }));
+		}
+		return rays;
+	}
+
+	/**
+	 * @brief Find the nearest panel hit by each hand ray through the BVH.
+	 *
+	 * Arguments: panel count.
+	 */
+	static void BM_BoundingVolumeHierarchyHandRays(benchmark::State &state)
+	{
+		const auto count  = static_cast<std::size_t>(state.range(0));
+		const auto panels = scatterPanels(count);
+		const auto rays	  = aimRays(64);
+		BoundingVolumeHierarchy hierarchy;
+		for (std::size_t index = 0; index < count; ++index) {
+			hierarchy.insert(index, panels[index]);
+		}
+
+		std::vector<std::optional<RayHit>> hits(HandRays);
+		std::size_t first = 0;
+		for (auto _: state) {
+			hierarchy.intersectNearest(
+				std::span<const utility::graphic::RayF>(&rays[first],
+														HandRays),
+				hits);
+			benchmark::DoNotOptimize(hits.data());
+			first = (first + HandRays) % rays.size();
+		}
+	}
+	BENCHMARK(BM_BoundingVolumeHierarchyHandRays)
+		->Arg(1000)
+		->Arg(10000)
+		->Arg(50000);
+
+	/**
+	 * @brief Same rays tested against every panel: the cost of one test per
+	 * entity per hand.
+	 *
+	 * Arguments: panel count.
+	 */
+	static void BM_LinearHandRays(benchmark::State &state)
+	{
+		const auto count  = static_cast<std::size_t>(state.range(0));
+		const auto panels = scatterPanels(count);
+		const auto rays	  = aimRays(64);
+
+		std::size_t first = 0;
+		for (auto _: state) {
+			for (std::size_t ray = first; ray < first + HandRays; ++ray) {
+				float nearest = std::numeric_limits<float>::max();
+				std::optional<std::size_t> hit;
+				for (std::size_t index = 0; index < count; ++index) {
+					float distance = 0.0f;
+					if (panels[index].intersect(rays[ray], nearest,
+												distance)) {
+						nearest = distance;
+						hit		= index;
+					}
+				}
+				benchmark::DoNotOptimize(hit);
+			}
+			first = (first + HandRays) % rays.size();
+		}
+	}
+	BENCHMARK(BM_LinearHandRays)->Arg(1000)->Arg(10000)->Arg(50000);
+
+}	 // namespace guillaume::spatial::benchmarks
\ No newline at end of file
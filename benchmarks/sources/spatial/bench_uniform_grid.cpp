@@ -0,0 +1,143 @@
+/*
+ Copyright (c) 2026 ETIB Corporation
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy of
+ this software and associated documentation files (the "Software"), to deal in
+ the Software without restriction, including without limitation the rights to
+ use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ of the Software, and to permit persons to whom the Software is furnished to do
+ so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in all
+ copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ SOFTWARE.
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <guillaume/spatial/uniform_grid.hpp>
+
+namespace guillaume::spatial::benchmarks
+{
+
+	/**
+	 * @brief Width and height of the laid out rows, as in a long list.
+	 */
+	constexpr float RowWidth  = 400.0f;
+	constexpr float RowHeight = 32.0f;
+
+	/**
+	 * @brief Lay out rectangles as rows of a grid of columns.
+	 * @param count The number of rectangles.
+	 * @return The rectangles.
+	 */
+	static std::vector<OrientedRectangle> layoutRows(std::size_t count)
+	{
+		std::vector<OrientedRectangle> rectangles;
+		rectangles.reserve(count);
+		for (std::size_t index = 0; index < count; ++index) {
+			const auto column = static_cast<float>(index % 8);
+			const auto row	  = static_cast<float>(index / 8);
+			rectangles.emplace_back(
+				utility::graphic::PositionF(column * RowWidth, row * RowHeight,
+											0.0f),
+				utility::graphic::OrientationF(), RowWidth, RowHeight);
+		}
+		return rectangles;
+	}
+
+	/**
+	 * @brief Resolve a pointer against indexed rectangles.
+	 *
+	 * Arguments: rectangle count.
+	 */
+	static void BM_UniformGridQueryPoint(benchmark::State &state)
+	{
+		const auto count	  = static_cast<std::size_t>(state.range(0));
+		const auto rectangles = layoutRows(count);
+		UniformGrid grid;
+		for (std::size_t index = 0; index < count; ++index) {
+			grid.insert(index, rectangles[index]);
+		}
+
+		std::vector<UniformGrid::Identifier> hits;
+		float y = 0.0f;
+		for (auto _: state) {
+			grid.queryPoint(utility::math::Vector2F({ 1000.0f, y }), hits);
+			benchmark::DoNotOptimize(hits.data());
+			y = y > static_cast<float>(count / 8) * RowHeight ? 0.0f
+															  : y + 7.0f;
+		}
+	}
+	BENCHMARK(BM_UniformGridQueryPoint)->Arg(1000)->Arg(10000)->Arg(50000);
+
+	/**
+	 * @brief Same pointer tested against every rectangle: the cost of hit
+	 * testing without the grid.
+	 *
+	 * Arguments: rectangle count.
+	 */
+	static void BM_LinearQueryPoint(benchmark::State &state)
+	{
+		const auto count	  = static_cast<std::size_t>(state.range(0));
+		const auto rectangles = layoutRows(count);
+
+		std::vector<UniformGrid::Identifier> hits;
+		float y = 0.0f;
+		for (auto _: state) {
+			hits.clear();
+			const utility::math::Vector2F point({ 1000.0f, y });
+			for (std::size_t index = 0; index < count; ++index) {
+				if (rectangles[index].containsProjected(point)) {
+					hits.push_back(index);
+				}
+			}
+			benchmark::DoNotOptimize(hits.data());
+			y = y > static_cast<float>(count / 8) * RowHeight ? 0.0f
+															  : y + 7.0f;
+		}
+	}
+	BENCHMARK(BM_LinearQueryPoint)->Arg(1000)->Arg(10000)->Arg(50000);
+
+	/**
+	 * @brief Move one rectangle per iteration, as an animated widget does.
+	 *
+	 * Arguments: rectangle count.
+	 */
+	static void BM_UniformGridMove(benchmark::State &state)
+	{
+		const auto count	  = static_cast<std::size_t>(state.range(0));
+		const auto rectangles = layoutRows(count);
+		UniformGrid grid;
+		for (std::size_t index = 0; index < count; ++index) {
+			grid.insert(index, rectangles[index]);
+		}
+
+		std::size_t index = 0;
+		float offset	  = 0.0f;
+		for (auto _: state) {
+			const auto &center = rectangles[index].getCenter();
+			grid.insert(index,
+						OrientedRectangle(
+							utility::graphic::PositionF(
+								center[0] + offset, center[1], 0.0f),
+							utility::graphic::OrientationF(), RowWidth,
+							RowHeight));
+			index  = (index + 1) % count;
+			offset = offset > 512.0f ? 0.0f : offset + 3.0f;
+		}
+	}
+	BENCHMARK(BM_UniformGridMove)->Arg(10000);
+
+}	 // namespace guillaume::spatial::benchmarks
\ No newline at end of file
@@ -23,6 +23,7 @@
 #pragma once
 
 #include <exception>
+#include <span>
 #include <string>
 #include <unordered_map>
 
@@ -116,6 +117,16 @@ namespace simple_application
 		void drawVertices(
 			const std::vector<utility::graphic::VertexF> &vertices) override;
 
+		/**
+		 * @brief Draw indexed triangles in a single immediate-mode batch.
+		 * @param vertices The vertex stream.
+		 * @param indices Three indices into the vertex stream per triangle.
+		 */
+		void drawTriangles(
+			std::span<const utility::graphic::VertexF> vertices,
+			std::span<const guillaume::RenderCommandList::Index> indices)
+			override;
+
 		/**
 		 * @brief Measure the size of the given text using the specified font.
 		 * @param text The text to draw.
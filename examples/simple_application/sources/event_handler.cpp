@@ -1,5 +1,8 @@
 #include "event_handler.hpp"
 
+#include <guillaume/event/event_pool.hpp>
+#include <guillaume/logging.hpp>
+
 #include <utility/event/mouse_motion_event.hpp>
 #include <utility/event/quit_event.hpp>
 
@@ -24,16 +27,19 @@ namespace simple_application
 
 		while (SDL_PollEvent(&sdlEvent)) {
 			setGotNewEvents(true);
-			getLogger().debug("Get new SDL event of type: "
-							  + std::to_string(sdlEvent.type));
+			guillaume::logging::debug(getLogger(), [&sdlEvent] {
+				return "Get new SDL event of type: "
+					+ std::to_string(sdlEvent.type);
+			});
 
-			std::unique_ptr<utility::event::Event> event = nullptr;
+			std::shared_ptr<utility::event::Event> event = nullptr;
 
 			switch (sdlEvent.type) {
 				case SDL_EVENT_QUIT: {
 					getLogger().info("Quit event received");
 					auto quitEvent =
-						std::make_unique<utility::event::QuitEvent>();
+						guillaume::event::makeEvent<
+							utility::event::QuitEvent>();
 					setShouldQuit(true);
 					event = std::move(quitEvent);
 					break;
@@ -47,7 +53,8 @@ namespace simple_application
 										  ? "KEY_DOWN"
 										  : "KEY_UP"));
 					auto keyEvent =
-						std::make_unique<utility::event::KeyboardEvent>();
+						guillaume::event::makeEvent<
+							utility::event::KeyboardEvent>();
 					keyEvent->setKeycode(convertKeyCode(sdlEvent.key.key));
 					keyEvent->setModifiers(
 						convertKeyModifiers(sdlEvent.key.mod));
@@ -61,7 +68,8 @@ namespace simple_application
 				case SDL_EVENT_TEXT_INPUT: {
 					getLogger().debug("Text input event received");
 					auto textInputEvent =
-						std::make_unique<utility::event::TextInputEvent>();
+						guillaume::event::makeEvent<
+							utility::event::TextInputEvent>();
 					textInputEvent->setText(std::string(sdlEvent.text.text));
 					event = std::move(textInputEvent);
 					break;
@@ -73,7 +81,8 @@ namespace simple_application
 									  + std::to_string(sdlEvent.button.y)
 									  + ")");
 					auto mouseEvent =
-						std::make_unique<utility::event::MouseButtonEvent>();
+						guillaume::event::makeEvent<
+							utility::event::MouseButtonEvent>();
 					mouseEvent->setPosition(
 						{ static_cast<float>(sdlEvent.button.x),
 						  static_cast<float>(sdlEvent.button.y) });
@@ -88,7 +97,8 @@ namespace simple_application
 									  + std::to_string(sdlEvent.button.y)
 									  + ")");
 					auto mouseEvent =
-						std::make_unique<utility::event::MouseButtonEvent>();
+						guillaume::event::makeEvent<
+							utility::event::MouseButtonEvent>();
 					mouseEvent->setPosition(
 						{ static_cast<float>(sdlEvent.button.x),
 						  static_cast<float>(sdlEvent.button.y) });
@@ -100,7 +110,8 @@ namespace simple_application
 
 				case SDL_EVENT_MOUSE_MOTION: {
 					auto motionEvent =
-						std::make_unique<utility::event::MouseMotionEvent>();
+						guillaume::event::makeEvent<
+							utility::event::MouseMotionEvent>();
 					motionEvent->setPosition(
 						{ static_cast<float>(sdlEvent.motion.x),
 						  static_cast<float>(sdlEvent.motion.y) });
@@ -115,7 +126,7 @@ namespace simple_application
 			}
 
 			if (event && getEventCallback()) {
-				getEventCallback()(event);
+				getEventCallback()(std::move(event));
 			}
 		}
 	}
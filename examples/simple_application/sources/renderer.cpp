@@ -195,6 +195,29 @@ namespace simple_application
 		glEnable(GL_DEPTH_TEST);
 	}
 
+	void Renderer::drawTriangles(
+		std::span<const utility::graphic::VertexF> vertices,
+		std::span<const guillaume::RenderCommandList::Index> indices)
+	{
+		const auto viewPosition = getView().getPose().getPosition();
+
+		glDisable(GL_DEPTH_TEST);
+		glDisable(GL_TEXTURE_2D);
+		glBindTexture(GL_TEXTURE_2D, 0);
+		glBegin(GL_TRIANGLES);
+		for (const auto index: indices) {
+			const auto &vertex = vertices[index];
+			glColor4ub(vertex.getColor().getRed(), vertex.getColor().getGreen(),
+					   vertex.getColor().getBlue(),
+					   vertex.getColor().getAlpha());
+			auto position = vertex.getPosition();
+			position -= viewPosition;
+			glVertex3f(position[0], position[1], position[2]);
+		}
+		glEnd();
+		glEnable(GL_DEPTH_TEST);
+	}
+
 	utility::math::Vector<std::float_t, 2>
 		Renderer::measureText(const utility::graphic::Text &text)
 	{
@@ -33,9 +33,14 @@
 #include <utility/logging/standard_logger.hpp>
 
 #include <utility/demangle.hpp>
+#include <utility/event/hand_motion_event.hpp>
+#include <utility/event/mouse_motion_event.hpp>
 
 #include "guillaume/ecs/system_registry.hpp"
+#include "guillaume/ecs/system_scheduler.hpp"
+#include "guillaume/ecs/thread_pool.hpp"
 
+#include "guillaume/logging.hpp"
 #include "guillaume/metadata.hpp"
 #include "guillaume/renderer.hpp"
 #include "guillaume/scene.hpp"
@@ -90,6 +95,21 @@ namespace guillaume
 			_sceneManager;			  ///< Manager for application scenes
 		event::EventBus _eventBus;	  ///< Event bus dispatching to systems
 		ecs::SystemRegistry _systemRegistry;	///< Shared system registry
+		ecs::ThreadPool _threadPool;	///< Pool running systems concurrently
+		ecs::SystemScheduler
+			_systemScheduler;	 ///< Scheduler running the systems by phase
+
+		/**
+		 * @brief Coalesce high-frequency input: only the last motion of a
+		 * frame matters, while buttons and text keep every event.
+		 */
+		void configureEventCoalescing(void)
+		{
+			_eventBus.setCoalescingPolicy<utility::event::MouseMotionEvent>(
+				event::CoalescingPolicy::LatestWins);
+			_eventBus.setCoalescingPolicy<utility::event::HandMotionEvent>(
+				event::CoalescingPolicy::LatestWins);
+		}
 
 		/**
 		 * @brief Register core systems used by the application.
@@ -122,10 +142,13 @@ namespace guillaume
 			, _sceneManager(nullptr)
 			, _eventBus()
 			, _systemRegistry()
+			, _threadPool()
+			, _systemScheduler(_systemRegistry, _threadPool)
 		{
+			configureEventCoalescing();
 			registerCoreSystems();
 			_eventHandler.setEventCallback(
-				[this](std::unique_ptr<utility::event::Event> &event) {
+				[this](event::EventHandler::EventPointer event) {
 					this->_eventBus.publish(std::move(event));
 				});
 			_sceneManager =
@@ -139,26 +162,45 @@ namespace guillaume
 		{
 		}
 
+		/**
+		 * @brief Get the event bus dispatching events to systems.
+		 * @return Reference to the event bus.
+		 * @note Input threads, such as an XR runtime's, may publish on it
+		 * concurrently with the main loop.
+		 */
+		event::EventBus &getEventBus(void)
+		{
+			return _eventBus;
+		}
+
 		/**
 		 * @brief Run one system update pass for the active scene.
+		 *
+		 * Coalesced events are delivered first, and the scene's command
+		 * buffer is applied after each phase.
 		 */
 		void routine(void)
 		{
+			_eventBus.flush();
 			for (const auto phase:
 				 { ecs::System::Phase::Event, ecs::System::Phase::Measure,
 				   ecs::System::Phase::Layout, ecs::System::Phase::Render }) {
-				this->getLogger().debug(
-					"Running systems for phase: "
-					+ std::to_string(static_cast<int>(phase)));
-				for (const auto &system:
-					 _systemRegistry.getSystemsByPhase(phase)) {
-					system->routine(_sceneManager->getActiveComponentRegistry(),
-									_sceneManager->getActiveEntityRegistry());
-				}
-				this->getLogger().debug(
-					"Finished systems for phase: "
-					+ std::to_string(static_cast<int>(phase)));
+				logging::debug(this->getLogger(), [phase] {
+					return "Running systems for phase: "
+						+ std::to_string(static_cast<int>(phase));
+				});
+				auto &componentRegistry =
+					_sceneManager->getActiveComponentRegistry();
+				auto &entityRegistry = _sceneManager->getActiveEntityRegistry();
+				_systemScheduler.run(phase, componentRegistry, entityRegistry);
+				_sceneManager->getActiveCommandBuffer().apply(
+					componentRegistry, entityRegistry);
+				logging::debug(this->getLogger(), [phase] {
+					return "Finished systems for phase: "
+						+ std::to_string(static_cast<int>(phase));
+				});
 			}
+			_sceneManager->getActiveComponentRegistry().advanceFrame();
 		}
 
 		/**
@@ -175,9 +217,12 @@ namespace guillaume
 						continue;
 					}
 					_renderer.clear();
+					_renderer.beginFrame();
 					routine();
+					_renderer.endFrame();
 					_renderer.present();
-					this->getLogger().debug("Processed a frame");
+					logging::debug(this->getLogger(),
+								   [] { return "Processed a frame"; });
 				} catch (const std::exception &exception) {
 					this->getLogger().error(std::string("Application error: ")
 											+ exception.what());
@@ -22,7 +22,11 @@
 
 #pragma once
 
+#include <array>
+#include <tuple>
+
 #include "guillaume/ecs/component_registry_filler.hpp"
+#include "guillaume/ecs/component_type_id.hpp"
 
 #include "guillaume/components/borders.hpp"
 #include "guillaume/components/bound.hpp"
@@ -35,25 +39,74 @@
 namespace guillaume
 {
 
+	/**
+	 * @brief Component types registered by ComponentRegistry.
+	 *
+	 * The stable id table, its uniqueness check and the registry are all
+	 * derived from this list.
+	 */
+	using BuiltInComponents =
+		std::tuple<components::Bound, components::Focus,
+				   components::Interaction, components::Text,
+				   components::Transform, components::Color,
+				   components::Borders>;
+
+	/**
+	 * @brief Trait deriving stable ids and a registry filler from a tuple of
+	 * component types.
+	 * @tparam Tuple The std::tuple of component types.
+	 */
+	template<typename Tuple> struct ComponentList;
+
+	template<ecs::InheritFromComponent... ComponentTypes>
+	struct ComponentList<std::tuple<ComponentTypes...>> {
+		/**
+		 * @brief Stable ids of the component types, in list order.
+		 */
+		constexpr static std::array<ecs::ComponentTypeId::StableId,
+									sizeof...(ComponentTypes)>
+			StableIds { ecs::ComponentTypeId::getStableId<
+				ComponentTypes>()... };
+
+		/**
+		 * @brief Whether no two component types share a stable id.
+		 */
+		constexpr static bool AreStableIdsUnique =
+			ecs::ComponentTypeId::areStableIdsUnique<ComponentTypes...>();
+
+		/**
+		 * @brief Registry filler registering the component types.
+		 */
+		using Filler = ecs::ComponentRegistryFiller<ComponentTypes...>;
+	};
+
+	/**
+	 * @brief Stable ids of the built-in component types, computed at compile
+	 * time.
+	 *
+	 * Snapshots and replay files refer to component types by these ids,
+	 * which stay the same across runs and builds.
+	 * @see ecs::ComponentTypeId::getStableId
+	 */
+	inline constexpr auto BuiltInComponentStableIds =
+		ComponentList<BuiltInComponents>::StableIds;
+
+	static_assert(ComponentList<BuiltInComponents>::AreStableIdsUnique,
+				  "Built-in component types must have distinct stable ids");
+
 	/**
 	 * @brief Component registry class registering all core components.
+	 * @see BuiltInComponents
 	 * @see ecs::ComponentRegistryFiller
 	 */
-	class ComponentRegistry:
-		public ecs::ComponentRegistryFiller<
-			components::Bound, components::Focus, components::Interaction,
-			components::Text, components::Transform, components::Color,
-			components::Borders>
+	class ComponentRegistry: public ComponentList<BuiltInComponents>::Filler
 	{
 		public:
 		/**
 		 * @brief Default constructor.
 		 */
 		ComponentRegistry(void)
-			: ecs::ComponentRegistryFiller<
-				  components::Bound, components::Focus, components::Interaction,
-				  components::Text, components::Transform, components::Color,
-				  components::Borders>()
+			: ComponentList<BuiltInComponents>::Filler()
 		{
 		}
 
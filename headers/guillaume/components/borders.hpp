@@ -23,6 +23,7 @@
 #pragma once
 
 #include <cmath>
+#include <string_view>
 
 #include "guillaume/ecs/component.hpp"
 
@@ -35,6 +36,13 @@ namespace guillaume::components
 	class Borders: public ecs::Component
 	{
 		public:
+		/**
+		 * @brief Name hashed into the stable id of the type.
+		 * @see ecs::ComponentTypeId::getStableId
+		 */
+		constexpr static std::string_view StableName =
+			"guillaume::components::Borders";
+
 		using BorderRadius = float;	   ///< Type representing the border
 									   ///< radius of the border
 
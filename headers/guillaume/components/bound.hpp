@@ -22,6 +22,8 @@ SOFTWARE.
 
 #pragma once
 
+#include <string_view>
+
 #include <utility/math/vector.hpp>
 
 #include "guillaume/ecs/component.hpp"
@@ -34,6 +36,14 @@ namespace guillaume::components
 	 */
 	class Bound: public ecs::Component
 	{
+		public:
+		/**
+		 * @brief Name hashed into the stable id of the type.
+		 * @see ecs::ComponentTypeId::getStableId
+		 */
+		constexpr static std::string_view StableName =
+			"guillaume::components::Bound";
+
 		private:
 		std::size_t _width { 0 };	  ///< Width of the bounding rectangle
 		std::size_t _height { 0 };	  ///< Height of the bounding rectangle
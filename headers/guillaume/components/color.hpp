@@ -22,6 +22,8 @@
 
 #pragma once
 
+#include <string_view>
+
 #include <utility/graphic/color.hpp>
 
 #include "guillaume/ecs/component.hpp"
@@ -34,6 +36,14 @@ namespace guillaume::components
 	 */
 	class Color: public ecs::Component
 	{
+		public:
+		/**
+		 * @brief Name hashed into the stable id of the type.
+		 * @see ecs::ComponentTypeId::getStableId
+		 */
+		constexpr static std::string_view StableName =
+			"guillaume::components::Color";
+
 		private:
 		utility::graphic::Color32Bit _color;	///< The color value
 
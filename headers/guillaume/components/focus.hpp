@@ -23,6 +23,7 @@
 #pragma once
 
 #include <functional>
+#include <string_view>
 
 #include "guillaume/ecs/component.hpp"
 
@@ -35,6 +36,13 @@ namespace guillaume::components
 	class Focus: public ecs::Component
 	{
 		public:
+		/**
+		 * @brief Name hashed into the stable id of the type.
+		 * @see ecs::ComponentTypeId::getStableId
+		 */
+		constexpr static std::string_view StableName =
+			"guillaume::components::Focus";
+
 		using Handler =
 			std::function<void(void)>;	  ///< Focus event handler type
 
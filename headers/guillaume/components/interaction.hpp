@@ -22,8 +22,10 @@
 
 #pragma once
 
-#include <functional>
-#include <map>
+#include <array>
+#include <bitset>
+#include <cstddef>
+#include <string_view>
 
 #include <utility/event/mouse_button_event.hpp>
 #include <utility/event/hand_button_event.hpp>
@@ -31,6 +33,7 @@
 #include <utility/event/hand_poke_event.hpp>
 
 #include "guillaume/ecs/component.hpp"
+#include "guillaume/small_function.hpp"
 
 namespace guillaume::components
 {
@@ -38,42 +41,68 @@ namespace guillaume::components
 	/**
 	 * @brief Component combining hover and click interactions in a single
 	 * component.
+	 *
+	 * Button handlers are kept in arrays indexed by button and pressed states
+	 * in bitmasks, and handlers are SmallFunction objects, so a component
+	 * holding handlers that capture a pointer or two allocates nothing.
 	 * @see systems::Interaction
 	 */
 	class Interaction: public ecs::Component
 	{
 		public:
+		/**
+		 * @brief Name hashed into the stable id of the type.
+		 * @see ecs::ComponentTypeId::getStableId
+		 */
+		constexpr static std::string_view StableName =
+			"guillaume::components::Interaction";
+
 		using MouseHoverHandler =
-			std::function<void(void)>;	  ///< Hover event handler type
+			SmallFunction<void(void)>;	  ///< Hover event handler type
 		using MouseUnhoverHandler =
-			std::function<void(void)>;	  ///< Unhover event handler type
+			SmallFunction<void(void)>;	  ///< Unhover event handler type
 
 		using MouseButtonClickHandler =
-			std::function<void(void)>;	  ///< Button click event handler type
+			SmallFunction<void(void)>;	  ///< Button click event handler type
 		using MouseButtonClickReleaseHandler =
-			std::function<void(void)>;	  ///< Button release event handler type
+			SmallFunction<void(void)>;	  ///< Button release event handler type
 
-		using HandHoverHandler   = std::function<void(
-			void)>;	   ///< Hand hover event handler type
-		using HandUnhoverHandler = std::function<void(
-			void)>;	   ///< Hand unhover event handler type
+		using HandHoverHandler =
+			SmallFunction<void(void)>;	  ///< Hand hover event handler type
+		using HandUnhoverHandler =
+			SmallFunction<void(void)>;	  ///< Hand unhover event handler type
 
 		using HandButtonClickHandler =
-			std::function<void(void)>;	  ///< Hand
-										  ///< button
-										  ///< click
-										  ///< event
+			SmallFunction<void(void)>;	  ///< Hand button click event handler
+										  ///< type
 		using HandButtonClickReleaseHandler =
-			std::function<void(void)>;	  ///< Hand
-										  ///< button
-										  ///< release
-										  ///< event
+			SmallFunction<void(void)>;	  ///< Hand button release event
+										  ///< handler type
 
 		using HandPinchHandler =
-			std::function<void(void)>;	  ///< Hand pinch event handler type
+			SmallFunction<void(void)>;	  ///< Hand pinch event handler type
 
 		using HandPokeHandler =
-			std::function<void(void)>;	  ///< Hand poke event handler type
+			SmallFunction<void(void)>;	  ///< Hand poke event handler type
+
+		/**
+		 * @brief Number of mouse buttons.
+		 */
+		static constexpr std::size_t MouseButtonCount =
+			static_cast<std::size_t>(
+				utility::event::MouseButtonEvent::Button::Last);
+
+		/**
+		 * @brief Number of hand buttons.
+		 */
+		static constexpr std::size_t HandButtonCount =
+			static_cast<std::size_t>(
+				utility::event::HandButtonEvent::Button::Last);
+
+		using MouseButtons =
+			std::bitset<MouseButtonCount>;	  ///< One bit per mouse button
+		using HandButtons =
+			std::bitset<HandButtonCount>;	 ///< One bit per hand button
 
 		private:
 		MouseHoverHandler _onMouseHover;		///< Hover enter event handler
@@ -82,16 +111,15 @@ namespace guillaume::components
 			false
 		};	  ///< Flag indicating if the entity is currently hovered
 
-		std::map<utility::event::MouseButtonEvent::Button,
-				 MouseButtonClickHandler>
-			_onMouseButtonClickHandlers {};	   ///< Click event handlers
-		std::map<utility::event::MouseButtonEvent::Button,
-				 MouseButtonClickReleaseHandler>
+		std::array<MouseButtonClickHandler, MouseButtonCount>
+			_onMouseButtonClickHandlers {};	   ///< Click event handlers,
+											   ///< indexed by button
+		std::array<MouseButtonClickReleaseHandler, MouseButtonCount>
 			_onMouseButtonClickReleaseHandlers {};	  ///< Release event
-													  ///< handlers
-		std::map<utility::event::MouseButtonEvent::Button, bool>
-			_isMouseButtonClicked {};	 ///< Flag indicating if the entity is
-										 ///< currently clicked
+													  ///< handlers, indexed
+													  ///< by button
+		MouseButtons _mouseButtonsClicked {};	 ///< Mouse buttons the entity
+												 ///< is currently clicked for
 
 		HandHoverHandler
 			_onHandHover;	   ///< Hand hover event handler
@@ -103,19 +131,15 @@ namespace guillaume::components
 		};	  ///< Flag indicating if the entity is currently hovered by a
 			  ///< hand
 
-		std::map<utility::event::HandButtonEvent::Button,
-				 HandButtonClickHandler>
-			_onHandButtonClickHandlers {};	///< Hand button click
-													///< event handlers
-		std::map<utility::event::HandButtonEvent::Button,
-				 HandButtonClickReleaseHandler>
-			_onHandButtonClickReleaseHandlers {};	   ///< Hand
-														   ///< button release
-														   ///< event handlers
-		std::map<utility::event::HandButtonEvent::Button, bool>
-			_isHandButtonClicked {};	  ///< Flag indicating if the entity
-											  ///< is currently clicked for a
-											  ///< hand button
+		std::array<HandButtonClickHandler, HandButtonCount>
+			_onHandButtonClickHandlers {};	  ///< Hand button click event
+											  ///< handlers, indexed by button
+		std::array<HandButtonClickReleaseHandler, HandButtonCount>
+			_onHandButtonClickReleaseHandlers {};	 ///< Hand button release
+													 ///< event handlers,
+													 ///< indexed by button
+		HandButtons _handButtonsClicked {};	   ///< Hand buttons the entity is
+											   ///< currently clicked for
 
 		HandPinchHandler _onHandPinchHandler;	 ///< Hand pinch event handler
 		bool _isHandPinched {
@@ -134,6 +158,9 @@ namespace guillaume::components
 		public:
 		/**
 		 * @brief Default constructor for the Interaction component.
+		 *
+		 * The component starts marked as changed, so that adding it shows
+		 * up in its storage's change log.
 		 */
 		Interaction(void);
 
@@ -163,13 +190,13 @@ namespace guillaume::components
 		 * @brief Get the mouse onHover event handler.
 		 * @return The hover enter handler.
 		 */
-		MouseHoverHandler getMouseOnHoverHandler(void) const;
+		const MouseHoverHandler &getMouseOnHoverHandler(void) const;
 
 		/**
 		 * @brief Get the mouse onUnhover event handler.
 		 * @return The hover leave handler.
 		 */
-		MouseUnhoverHandler getMouseOnUnhoverHandler(void) const;
+		const MouseUnhoverHandler &getMouseOnUnhoverHandler(void) const;
 
 		/**
 		 * @brief Check if the entity is currently hovered.
@@ -195,12 +222,12 @@ namespace guillaume::components
 			const MouseButtonClickHandler &handler);
 
 		/**
-		 * @brief Get click handlers indexed by mouse button.
-		 * @return A map of mouse buttons to click handlers.
+		 * @brief Get the onClick event handler of one mouse button.
+		 * @param button The mouse button.
+		 * @return The click handler, empty if none is set.
 		 */
-		const std::map<utility::event::MouseButtonEvent::Button,
-					   MouseButtonClickHandler> &
-			getMouseButtonOnClickHandlers() const;
+		const MouseButtonClickHandler &getMouseButtonOnClickHandler(
+			const utility::event::MouseButtonEvent::Button &button) const;
 
 		/**
 		 * @brief Set the onRelease event handler for one mouse button.
@@ -213,12 +240,19 @@ namespace guillaume::components
 			const MouseButtonClickReleaseHandler &handler);
 
 		/**
-		 * @brief Get click release handlers indexed by mouse button.
-		 * @return A map of mouse buttons to release handlers.
+		 * @brief Get the onRelease event handler of one mouse button.
+		 * @param button The mouse button.
+		 * @return The release handler, empty if none is set.
+		 */
+		const MouseButtonClickReleaseHandler &
+			getMouseButtonOnClickReleaseHandler(
+				const utility::event::MouseButtonEvent::Button &button) const;
+
+		/**
+		 * @brief Get the mouse buttons the entity is clicked for.
+		 * @return One bit per mouse button, set while clicked.
 		 */
-		const std::map<utility::event::MouseButtonEvent::Button,
-					   MouseButtonClickReleaseHandler> &
-			getMouseButtonOnClickReleaseHandlers() const;
+		const MouseButtons &getMouseButtonsClicked(void) const;
 
 		/**
 		 * @brief Check if the entity is currently clicked for one mouse button.
@@ -249,12 +283,12 @@ namespace guillaume::components
 			const HandButtonClickHandler &handler);
 
 		/**
-		 * @brief Get click handlers indexed by hand button.
-		 * @return A map of hand buttons to click handlers.
+		 * @brief Get the onClick event handler of one hand button.
+		 * @param button The hand button.
+		 * @return The click handler, empty if none is set.
 		 */
-		const std::map<utility::event::HandButtonEvent::Button,
-					   HandButtonClickHandler> &
-			getHandButtonOnClickHandlers() const;
+		const HandButtonClickHandler &getHandButtonOnClickHandler(
+			const utility::event::HandButtonEvent::Button &button) const;
 
 		/**
 		 * @brief Set the onRelease event handler for one hand button.
@@ -267,12 +301,19 @@ namespace guillaume::components
 			const HandButtonClickReleaseHandler &handler);
 
 		/**
-		 * @brief Get click release handlers indexed by hand button.
-		 * @return A map of hand buttons to release handlers.
+		 * @brief Get the onRelease event handler of one hand button.
+		 * @param button The hand button.
+		 * @return The release handler, empty if none is set.
+		 */
+		const HandButtonClickReleaseHandler &
+			getHandButtonOnClickReleaseHandler(
+				const utility::event::HandButtonEvent::Button &button) const;
+
+		/**
+		 * @brief Get the hand buttons the entity is clicked for.
+		 * @return One bit per hand button, set while clicked.
 		 */
-		const std::map<utility::event::HandButtonEvent::Button,
-					   HandButtonClickReleaseHandler> &
-			getHandButtonOnClickReleaseHandlers() const;
+		const HandButtons &getHandButtonsClicked(void) const;
 
 		/**
 		 * @brief Check if the entity is currently clicked for one hand
@@ -315,13 +356,13 @@ namespace guillaume::components
 		 * @brief Get the hand onHover event handler.
 		 * @return The hover enter handler.
 		 */
-		HandHoverHandler getHandOnHoverHandler(void) const;
+		const HandHoverHandler &getHandOnHoverHandler(void) const;
 
 		/**
 		 * @brief Get the hand onUnhover event handler.
 		 * @return The hover leave handler.
 		 */
-		HandUnhoverHandler getHandOnUnhoverHandler(void) const;
+		const HandUnhoverHandler &getHandOnUnhoverHandler(void) const;
 
 		/**
 		 * @brief Check if the entity is currently hovered.
@@ -347,7 +388,7 @@ namespace guillaume::components
 		 * @brief Get the onHandPinch event handler.
 		 * @return The hand pinch event handler.
 		 */
-		HandPinchHandler getHandPinchHandler(void) const;
+		const HandPinchHandler &getHandPinchHandler(void) const;
 
 		/**
 		 * @brief Check if the entity is currently clicked for a hand pinch.
@@ -373,7 +414,7 @@ namespace guillaume::components
 		 * @brief Get the onHandPoke event handler.
 		 * @return The hand poke event handler.
 		 */
-		HandPokeHandler getHandPokeHandler(void) const;
+		const HandPokeHandler &getHandPokeHandler(void) const;
 
 		/**
 		 * @brief Check if the entity is currently clicked for a hand poke.
@@ -23,6 +23,7 @@
 #pragma once
 
 #include <string>
+#include <string_view>
 
 #include <utility/graphic/color.hpp>
 
@@ -39,6 +40,14 @@ namespace guillaume::components
 	 */
 	class Text: public ecs::Component
 	{
+		public:
+		/**
+		 * @brief Name hashed into the stable id of the type.
+		 * @see ecs::ComponentTypeId::getStableId
+		 */
+		constexpr static std::string_view StableName =
+			"guillaume::components::Text";
+
 		private:
 		std::string _content {};		 ///< Text content
 		std::size_t _fontSize { 24 };	 ///< Font size of the text
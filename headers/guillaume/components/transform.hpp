@@ -22,6 +22,8 @@
 
 #pragma once
 
+#include <string_view>
+
 #include <utility/graphic/pose.hpp>
 
 #include "guillaume/ecs/component.hpp"
@@ -34,6 +36,14 @@ namespace guillaume::components
 	 */
 	class Transform: public ecs::Component
 	{
+		public:
+		/**
+		 * @brief Name hashed into the stable id of the type.
+		 * @see ecs::ComponentTypeId::getStableId
+		 */
+		constexpr static std::string_view StableName =
+			"guillaume::components::Transform";
+
 		private:
 		utility::graphic::PoseF _pose {};	 ///< Pose of the entity
 
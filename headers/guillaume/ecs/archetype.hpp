@@ -0,0 +1,141 @@
+/*
+ Copyright (c) 2026 ETIB Corporation
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy of
+ this software and associated documentation files (the "Software"), to deal in
+ the Software without restriction, including without limitation the rights to
+ use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ of the Software, and to permit persons to whom the Software is furnished to do
+ so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in all
+ copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ SOFTWARE.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <utility/demangle.hpp>
+
+#include "guillaume/ecs/component_storage.hpp"
+#include "guillaume/ecs/entity.hpp"
+
+namespace guillaume::ecs
+{
+
+	/**
+	 * @brief Packed group of entities sharing a set of component types.
+	 *
+	 * An archetype owns the storages of its component types and keeps every
+	 * entity that has all of them in the first size() slots of each storage,
+	 * in the same order. The leading part of each storage is then a column of
+	 * a structure-of-arrays table: index `i` of every column belongs to the
+	 * same entity, so systems can stream the columns linearly instead of
+	 * looking every component up by entity.
+	 *
+	 * @note A component storage can be owned by at most one archetype.
+	 * @see ComponentRegistry::registerArchetype
+	 */
+	class Archetype
+	{
+		private:
+		Entity::Signature _signature;	 ///< Component types of the archetype
+		std::vector<IComponentStorage *>
+			_storages;			///< Owned storages, one per component type
+		std::size_t _size { 0 };	///< Number of packed entities
+
+		public:
+		/**
+		 * @brief Construct an archetype over a set of storages.
+		 * @param signature Signature of the grouped component types.
+		 * @param storages Storages of the grouped component types.
+		 * @note Entities already holding every component are packed
+		 * immediately.
+		 */
+		Archetype(const Entity::Signature &signature,
+				  std::vector<IComponentStorage *> storages);
+
+		/**
+		 * @brief Default destructor.
+		 */
+		~Archetype(void) = default;
+
+		/**
+		 * @brief Get the signature of the grouped component types.
+		 * @return The archetype signature.
+		 */
+		const Entity::Signature &getSignature(void) const;
+
+		/**
+		 * @brief Get the number of packed entities.
+		 * @return The number of rows of each column.
+		 */
+		std::size_t size(void) const;
+
+		/**
+		 * @brief Get the identifiers of the packed entities.
+		 * @return Identifiers in column order.
+		 */
+		std::span<const Entity::Identifier> getIdentifiers(void) const;
+
+		/**
+		 * @brief Check whether an entity is packed in the archetype.
+		 * @param entityIdentifier The entity identifier.
+		 * @return True if the entity is part of the archetype.
+		 */
+		bool contains(const Entity::Identifier &entityIdentifier) const;
+
+		/**
+		 * @brief Pack an entity if it now owns every grouped component.
+		 * @param entityIdentifier The entity identifier.
+		 */
+		void refresh(const Entity::Identifier &entityIdentifier);
+
+		/**
+		 * @brief Unpack an entity before one of its grouped components is
+		 * removed.
+		 * @param entityIdentifier The entity identifier.
+		 */
+		void erase(const Entity::Identifier &entityIdentifier);
+
+		/**
+		 * @brief Get the column of one grouped component type.
+		 * @tparam ComponentType The component type, which must be part of the
+		 * archetype signature.
+		 * @param storage The storage of the component type.
+		 * @return The packed components, aligned with getIdentifiers().
+		 * @throws std::invalid_argument If the storage is not one of the
+		 * archetype's columns.
+		 */
+		template<InheritFromComponent ComponentType> std::span<ComponentType>
+			getColumn(ComponentStorage<ComponentType> &storage) const
+		{
+			const auto *column = static_cast<IComponentStorage *>(&storage);
+			if (!_signature.test(ComponentTypeId::get<ComponentType>())
+				|| std::find(_storages.begin(), _storages.end(), column)
+					== _storages.end()
+				|| storage.size() < _size) {
+				throw std::invalid_argument(
+					"Storage of " + utility::demangle<ComponentType>()
+					+ " is not a column of this archetype");
+			}
+			return std::span<ComponentType>(storage.getComponents().data(),
+											 _size);
+		}
+	};
+
+}	 // namespace guillaume::ecs
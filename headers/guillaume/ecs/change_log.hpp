@@ -0,0 +1,113 @@
+/*
+ Copyright (c) 2026 ETIB Corporation
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy of
+ this software and associated documentation files (the "Software"), to deal in
+ the Software without restriction, including without limitation the rights to
+ use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ of the Software, and to permit persons to whom the Software is furnished to do
+ so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in all
+ copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ SOFTWARE.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <span>
+#include <vector>
+
+#include "guillaume/ecs/change_tracker.hpp"
+#include "guillaume/ecs/entity.hpp"
+
+namespace guillaume::ecs
+{
+
+	/**
+	 * @brief Per component type list of changes.
+	 *
+	 * Each storage owns a change log. A component appends its owner to the
+	 * log the first time it is marked as changed after a reset, tagged with
+	 * the frame of the change. Entries are therefore sorted by frame, which
+	 * makes "changed since frame N" a binary search. Storages also keep a
+	 * second log of removed components, which does not track pending
+	 * entities.
+	 * @see ChangeTracker
+	 */
+	class ChangeLog
+	{
+		public:
+		using Frame = ChangeTracker::Frame;	   ///< Type alias for frames
+
+		/**
+		 * @brief A recorded change.
+		 */
+		struct Entry {
+			Entity::Identifier identifier;	  ///< Owner of the component
+			Frame frame;	///< Frame the change happened in
+		};
+
+		private:
+		ChangeTracker *_tracker;	///< Registry-wide tracker, if any
+		std::vector<Entry> _entries;	///< Recorded changes, by frame
+		std::size_t _pendingBegin { 0 };	///< First entry not yet reset
+		bool _tracksPending;	///< Whether entries wait for markHandled()
+
+		public:
+		/**
+		 * @brief Construct an empty change log.
+		 * @param tracker The registry-wide tracker to notify, or nullptr.
+		 * @param tracksPending Whether recorded entities are reported to the
+		 * tracker and stay pending until markHandled(). Removal logs do not
+		 * track them: there is nothing left to update.
+		 */
+		explicit ChangeLog(ChangeTracker *tracker = nullptr,
+						   bool tracksPending = true);
+
+		/**
+		 * @brief Default destructor.
+		 */
+		~ChangeLog(void) = default;
+
+		/**
+		 * @brief Record a change of an entity's component.
+		 * @param entityIdentifier The entity identifier.
+		 */
+		void record(const Entity::Identifier &entityIdentifier);
+
+		/**
+		 * @brief Get the changes recorded since the last reset.
+		 * @return View over the pending entries.
+		 */
+		std::span<const Entry> getPending(void) const;
+
+		/**
+		 * @brief Mark every recorded change as handled.
+		 */
+		void markHandled(void);
+
+		/**
+		 * @brief Get the changes recorded during or after a frame.
+		 * @param frame The first frame of interest.
+		 * @return View over the matching entries, oldest first.
+		 * @note Entries may refer to entities that no longer own the component.
+		 */
+		std::span<const Entry> getSince(Frame frame) const;
+
+		/**
+		 * @brief Drop the handled changes recorded before a frame.
+		 * @param frame The first frame to keep.
+		 */
+		void discardBefore(Frame frame);
+	};
+
+}	 // namespace guillaume::ecs
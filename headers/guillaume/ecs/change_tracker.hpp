@@ -0,0 +1,101 @@
+/*
+ Copyright (c) 2026 ETIB Corporation
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy of
+ this software and associated documentation files (the "Software"), to deal in
+ the Software without restriction, including without limitation the rights to
+ use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ of the Software, and to permit persons to whom the Software is furnished to do
+ so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in all
+ copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ SOFTWARE.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <mutex>
+#include <unordered_set>
+#include <vector>
+
+#include "guillaume/ecs/entity.hpp"
+
+namespace guillaume::ecs
+{
+
+	/**
+	 * @brief Registry-wide change bookkeeping shared by component storages.
+	 *
+	 * Holds the current frame number and the deduplicated list of entities
+	 * with at least one component changed since the last reset, so change
+	 * handling costs scale with the number of changes rather than the scene
+	 * size.
+	 * @see ChangeLog
+	 */
+	class ChangeTracker
+	{
+		public:
+		using Frame = std::uint64_t;	///< Type alias for frame numbers
+
+		private:
+		Frame _frame { 0 };	   ///< Current frame number
+		std::vector<Entity::Identifier>
+			_pendingEntities;	 ///< Changed entities, in change order
+		std::unordered_set<Entity::Identifier>
+			_pendingLookup;	   ///< Membership of _pendingEntities
+		std::mutex _mutex;	  ///< Guards recording from concurrent systems
+
+		public:
+		/**
+		 * @brief Default constructor.
+		 */
+		ChangeTracker(void) = default;
+
+		/**
+		 * @brief Default destructor.
+		 */
+		~ChangeTracker(void) = default;
+
+		/**
+		 * @brief Get the current frame number.
+		 * @return The current frame number.
+		 */
+		Frame getFrame(void) const;
+
+		/**
+		 * @brief Move on to the next frame.
+		 */
+		void advanceFrame(void);
+
+		/**
+		 * @brief Record that an entity has a changed component.
+		 *
+		 * Safe to call from systems running concurrently.
+		 * @param entityIdentifier The entity identifier.
+		 */
+		void record(const Entity::Identifier &entityIdentifier);
+
+		/**
+		 * @brief Get the entities changed since the last reset.
+		 * @return Const reference to the identifiers, in change order.
+		 * @note Entities recorded while iterating are appended, so iterate by
+		 * index when the loop body may change components.
+		 */
+		const std::vector<Entity::Identifier> &getPendingEntities(void) const;
+
+		/**
+		 * @brief Forget the pending entities.
+		 */
+		void clearPending(void);
+	};
+
+}	 // namespace guillaume::ecs
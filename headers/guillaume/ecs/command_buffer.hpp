@@ -0,0 +1,184 @@
+/*
+ Copyright (c) 2026 ETIB Corporation
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy of
+ this software and associated documentation files (the "Software"), to deal in
+ the Software without restriction, including without limitation the rights to
+ use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ of the Software, and to permit persons to whom the Software is furnished to do
+ so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in all
+ copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ SOFTWARE.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "guillaume/ecs/component.hpp"
+#include "guillaume/ecs/component_registry.hpp"
+#include "guillaume/ecs/component_type_id.hpp"
+#include "guillaume/ecs/entity.hpp"
+#include "guillaume/ecs/entity_registry.hpp"
+
+namespace guillaume::ecs
+{
+
+	/**
+	 * @brief Deferred list of structural changes to a scene.
+	 *
+	 * Creating or destroying entities and adding or removing components
+	 * while systems iterate the registries invalidates the containers being
+	 * iterated. Callbacks running inside systems, such as click handlers,
+	 * record these changes instead; they are applied in one batch at the
+	 * next phase boundary, in recording order. Recording is thread-safe.
+	 * @see Application::routine
+	 */
+	class CommandBuffer
+	{
+		public:
+		/**
+		 * @brief Arbitrary structural change applied to the registries.
+		 */
+		using Command = std::function<void(ComponentRegistry &componentRegistry,
+										   EntityRegistry &entityRegistry)>;
+
+		/**
+		 * @brief Function creating an entity and registering its components.
+		 */
+		using Factory = std::function<std::unique_ptr<Entity>(
+			ComponentRegistry &componentRegistry)>;
+
+		private:
+		mutable std::mutex _mutex;	  ///< Guards concurrent recording
+		std::vector<Command> _commands;	   ///< Changes in recording order
+		std::unordered_map<EntityRegistry *, std::size_t>
+			_createdEntities;	 ///< Entities to create per parent registry
+		std::unordered_map<std::size_t, std::size_t>
+			_addedComponents;	 ///< Components to add per ComponentTypeId
+
+		/**
+		 * @brief Append a command.
+		 * @param command The command to append.
+		 */
+		void push(Command command);
+
+		public:
+		/**
+		 * @brief Default constructor.
+		 */
+		CommandBuffer(void) = default;
+
+		/**
+		 * @brief Default destructor.
+		 */
+		~CommandBuffer(void) = default;
+
+		/**
+		 * @brief Record the creation of an entity.
+		 * @param factory The function building the entity, called when the
+		 * buffer is applied.
+		 * @param parent The registry receiving the entity, or nullptr for the
+		 * registry the buffer is applied to.
+		 */
+		void createEntity(Factory factory, EntityRegistry *parent = nullptr);
+
+		/**
+		 * @brief Record the destruction of an entity and its descendants.
+		 * @param entityIdentifier The entity identifier.
+		 * @see EntityRegistry::destroyEntity
+		 */
+		void destroyEntity(const Entity::Identifier &entityIdentifier);
+
+		/**
+		 * @brief Record the addition or replacement of a component.
+		 * @tparam ComponentType The type of the component to add.
+		 * @param entityIdentifier The entity identifier.
+		 * @param args Arguments forwarded to the component constructor now.
+		 */
+		template<InheritFromComponent ComponentType, typename... Args>
+		void addComponent(const Entity::Identifier &entityIdentifier,
+						  Args &&...args)
+		{
+			Command command =
+				[entityIdentifier,
+				 component = ComponentType(std::forward<Args>(args)...)](
+					ComponentRegistry &componentRegistry,
+					EntityRegistry &) mutable {
+					componentRegistry.addComponent<ComponentType>(
+						entityIdentifier, std::move(component));
+				};
+
+			// apply() swaps the counters and the commands together, so they
+			// must change together too.
+			std::lock_guard lock(_mutex);
+			++_addedComponents[ComponentTypeId::get<ComponentType>()];
+			_commands.push_back(std::move(command));
+		}
+
+		/**
+		 * @brief Record the removal of a component.
+		 * @tparam ComponentType The type of the component to remove.
+		 * @param entityIdentifier The entity identifier.
+		 */
+		template<InheritFromComponent ComponentType>
+		void removeComponent(const Entity::Identifier &entityIdentifier)
+		{
+			push([entityIdentifier](ComponentRegistry &componentRegistry,
+									EntityRegistry &) {
+				componentRegistry.removeComponent<ComponentType>(
+					entityIdentifier);
+			});
+		}
+
+		/**
+		 * @brief Record an arbitrary structural change, such as a call to an
+		 * EntityBuilder or an EntityDirector.
+		 * @param command The command to record.
+		 */
+		void record(Command command);
+
+		/**
+		 * @brief Check whether no change is recorded.
+		 * @return True if the buffer is empty.
+		 */
+		bool empty(void) const;
+
+		/**
+		 * @brief Get the number of recorded changes.
+		 * @return The number of recorded changes.
+		 */
+		std::size_t size(void) const;
+
+		/**
+		 * @brief Apply and clear the recorded changes.
+		 *
+		 * Entity and component containers are grown once for all the
+		 * recorded creations and additions. Changes recorded while applying
+		 * are applied as well.
+		 * @param componentRegistry The registry holding the components.
+		 * @param entityRegistry The root registry of the hierarchy.
+		 * @throws Any exception thrown by a change. The changes recorded
+		 * after it are put back at the front of the buffer, ahead of those
+		 * recorded while applying, so a later call applies them.
+		 */
+		void apply(ComponentRegistry &componentRegistry,
+				   EntityRegistry &entityRegistry);
+	};
+
+}	 // namespace guillaume::ecs
@@ -22,11 +22,14 @@
 
 #pragma once
 
+#include <cstddef>
 #include <type_traits>
 
 namespace guillaume::ecs
 {
 
+	class ChangeLog;
+
 	/**
 	 * @brief Base class for all components in the ECS architecture.
 	 *
@@ -38,6 +41,8 @@ namespace guillaume::ecs
 	{
 		private:
 		bool _hasChanged { false };
+		ChangeLog *_changeLog { nullptr };	  ///< Log notified of changes
+		std::size_t _owner { 0 };	 ///< Identifier of the owning entity
 
 		public:
 		/**
@@ -49,10 +54,21 @@ namespace guillaume::ecs
 
 		/**
 		 * @brief Set the changed state for the component.
+		 *
+		 * Marking an unchanged component as changed records its owner in the
+		 * attached change log.
 		 * @param hasChanged New changed state value.
 		 */
 		void setHasChanged(bool hasChanged);
 
+		/**
+		 * @brief Attach the change log of the storage holding the component.
+		 * @param changeLog The change log to notify.
+		 * @param owner Identifier of the owning entity.
+		 * @note Called by ComponentStorage when the component is stored.
+		 */
+		void attachChangeLog(ChangeLog *changeLog, std::size_t owner);
+
 		/**
 		 * @brief Default constructor for the Component class.
 		 */
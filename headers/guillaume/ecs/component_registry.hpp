@@ -23,22 +23,29 @@
 #pragma once
 
 #include <exception>
-#include <map>
 #include <memory>
+#include <span>
+#include <stdexcept>
 #include <string>
 #include <type_traits>
-#include <typeindex>
 #include <utility>
+#include <vector>
 
 #include <utility/logging/loggable.hpp>
 #include <utility/logging/standard_logger.hpp>
 
 #include <utility/demangle.hpp>
 
+#include "guillaume/ecs/archetype.hpp"
+#include "guillaume/ecs/change_log.hpp"
+#include "guillaume/ecs/change_tracker.hpp"
 #include "guillaume/ecs/component.hpp"
 #include "guillaume/ecs/component_storage.hpp"
+#include "guillaume/ecs/component_type_id.hpp"
 #include "guillaume/ecs/entity.hpp"
 
+#include "guillaume/logging.hpp"
+
 namespace guillaume::ecs
 {
 
@@ -94,9 +101,24 @@ namespace guillaume::ecs
 		public utility::logging::Loggable<ComponentRegistry,
 										  utility::logging::StandardLogger>
 	{
+		public:
+		using Frame = ChangeTracker::Frame;	   ///< Type alias for frames
+
+		/**
+		 * @brief Number of past frames whose changes stay queryable.
+		 * @see getChangesSince
+		 */
+		constexpr static Frame ChangeHistoryLength = 64;
+
 		private:
-		std::map<std::type_index, std::unique_ptr<IComponentStorage>>
-			_storages;	  ///< Registered component storages
+		std::unique_ptr<ChangeTracker> _changeTracker {
+			std::make_unique<ChangeTracker>()
+		};	  ///< Changes shared by all storages
+		std::vector<std::unique_ptr<IComponentStorage>>
+			_storages;	  ///< Registered component storages, indexed by
+						  ///< ComponentTypeId
+		std::vector<std::unique_ptr<Archetype>>
+			_archetypes;	///< Opt-in archetypes packing their storages
 
 		/**
 		 * @brief Get or create a storage for a component type.
@@ -106,17 +128,51 @@ namespace guillaume::ecs
 		template<InheritFromComponent ComponentType>
 		ComponentStorage<ComponentType> &getOrCreateStorage(void)
 		{
-			const std::type_index typeIndex(typeid(ComponentType));
-			auto iterator = _storages.find(typeIndex);
-			if (iterator == _storages.end()) {
-				auto storage =
-					std::make_unique<ComponentStorage<ComponentType>>();
-				auto [insertedIterator, inserted] =
-					_storages.emplace(typeIndex, std::move(storage));
-				iterator = insertedIterator;
+			const std::size_t typeId = ComponentTypeId::get<ComponentType>();
+			if (typeId >= _storages.size()) {
+				_storages.resize(typeId + 1);
+			}
+			auto &storage = _storages[typeId];
+			if (!storage) {
+				storage = std::make_unique<ComponentStorage<ComponentType>>(
+					_changeTracker.get());
+			}
+			return static_cast<ComponentStorage<ComponentType> &>(*storage);
+		}
+
+		/**
+		 * @brief Find the storage of a component type without creating it.
+		 * @tparam ComponentType The type of component stored.
+		 * @return Pointer to the storage.
+		 * @retval nullptr No storage exists for the component type.
+		 */
+		template<InheritFromComponent ComponentType>
+		const ComponentStorage<ComponentType> *findStorage(void) const
+		{
+			const std::size_t typeId = ComponentTypeId::get<ComponentType>();
+			if (typeId >= _storages.size()) {
+				return nullptr;
+			}
+			return static_cast<const ComponentStorage<ComponentType> *>(
+				_storages[typeId].get());
+		}
+
+		/**
+		 * @brief Get the archetype owning a component type's storage.
+		 * @tparam ComponentType The component type.
+		 * @return Pointer to the owning archetype.
+		 * @retval nullptr The storage is not owned by any archetype.
+		 */
+		template<InheritFromComponent ComponentType>
+		Archetype *findOwningArchetype(void) const
+		{
+			const std::size_t typeId = ComponentTypeId::get<ComponentType>();
+			for (const auto &archetype: _archetypes) {
+				if (archetype->getSignature().test(typeId)) {
+					return archetype.get();
+				}
 			}
-			return static_cast<ComponentStorage<ComponentType> &>(
-				*iterator->second);
+			return nullptr;
 		}
 
 		/**
@@ -128,12 +184,12 @@ namespace guillaume::ecs
 		template<InheritFromComponent ComponentType>
 		void registerComponent(const Entity::Identifier &entityIdentifier)
 		{
-			auto &storage = getOrCreateStorage<ComponentType>();
-			storage.emplace(entityIdentifier);
-			getLogger().debug("Registered component of type "
-							  + utility::demangle<ComponentType>()
-							  + " for entity "
-							  + std::to_string(entityIdentifier));
+			addComponent<ComponentType>(entityIdentifier);
+			logging::debug(getLogger(), [&entityIdentifier] {
+				return "Registered component of type "
+					+ utility::demangle<ComponentType>() + " for entity "
+					+ std::to_string(entityIdentifier);
+			});
 		}
 
 		protected:
@@ -184,8 +240,11 @@ namespace guillaume::ecs
 									Args &&...args)
 		{
 			auto &storage = getOrCreateStorage<ComponentType>();
-			return storage.emplace(entityIdentifier,
-								   std::forward<Args>(args)...);
+			storage.emplace(entityIdentifier, std::forward<Args>(args)...);
+			if (auto *archetype = findOwningArchetype<ComponentType>()) {
+				archetype->refresh(entityIdentifier);
+			}
+			return *storage.find(entityIdentifier);
 		}
 
 		/**
@@ -197,12 +256,8 @@ namespace guillaume::ecs
 		template<InheritFromComponent ComponentType>
 		bool hasComponent(const Entity::Identifier &entityIdentifier) const
 		{
-			const std::type_index typeIndex(typeid(ComponentType));
-			auto iterator = _storages.find(typeIndex);
-			if (iterator == _storages.end()) {
-				return false;
-			}
-			return iterator->second->has(entityIdentifier);
+			const auto *storage = findStorage<ComponentType>();
+			return storage != nullptr && storage->has(entityIdentifier);
 		}
 
 		/**
@@ -214,9 +269,101 @@ namespace guillaume::ecs
 		void removeComponent(const Entity::Identifier &entityIdentifier)
 		{
 			auto &storage = getOrCreateStorage<ComponentType>();
+			if (auto *archetype = findOwningArchetype<ComponentType>()) {
+				archetype->erase(entityIdentifier);
+			}
 			storage.remove(entityIdentifier);
 		}
 
+		/**
+		 * @brief Grow the storage of a component type for upcoming
+		 * components.
+		 * @param typeId The ComponentTypeId of the component type.
+		 * @param additional The number of components about to be added.
+		 * @note Nothing is reserved if no storage exists for the type yet.
+		 */
+		void reserveComponents(std::size_t typeId, std::size_t additional)
+		{
+			if (typeId < _storages.size() && _storages[typeId]) {
+				_storages[typeId]->reserve(additional);
+			}
+		}
+
+		/**
+		 * @brief Remove every component of an entity.
+		 *
+		 * Each registered storage is visited once, so the cost scales with
+		 * the number of component types rather than the number of entities.
+		 * @param entityIdentifier The entity identifier.
+		 */
+		void destroyEntity(const Entity::Identifier &entityIdentifier)
+		{
+			for (const auto &archetype: _archetypes) {
+				archetype->erase(entityIdentifier);
+			}
+			for (auto &storage: _storages) {
+				if (storage) {
+					storage->remove(entityIdentifier);
+				}
+			}
+		}
+
+		/**
+		 * @brief Register an archetype packing the given component types.
+		 *
+		 * Entities owning every listed component are kept at the front of
+		 * each of these storages, in the same order, so the components can
+		 * be streamed as aligned columns. Components must then be added and
+		 * removed through this registry to keep the archetype packed.
+		 * @tparam ComponentTypes The component types grouped by the archetype.
+		 * @return Reference to the registered archetype.
+		 * @throws std::runtime_error If one of the component types is already
+		 * owned by another archetype.
+		 */
+		template<InheritFromComponent... ComponentTypes>
+		Archetype &registerArchetype(void)
+		{
+			const auto signature =
+				Entity::getSignatureFromTypes<ComponentTypes...>();
+			for (const auto &archetype: _archetypes) {
+				if (archetype->getSignature() == signature) {
+					return *archetype;
+				}
+				if ((archetype->getSignature() & signature).any()) {
+					throw std::runtime_error(
+						"Component type already owned by another archetype");
+				}
+			}
+			_archetypes.push_back(std::make_unique<Archetype>(
+				signature,
+				std::vector<IComponentStorage *> {
+					&getOrCreateStorage<ComponentTypes>()... }));
+			logging::debug(getLogger(), [&signature] {
+				return "Registered archetype with signature "
+					+ signature.to_string();
+			});
+			return *_archetypes.back();
+		}
+
+		/**
+		 * @brief Get a registered archetype.
+		 * @tparam ComponentTypes The component types grouped by the archetype.
+		 * @return Pointer to the archetype.
+		 * @retval nullptr No archetype was registered for these types.
+		 */
+		template<InheritFromComponent... ComponentTypes>
+		Archetype *getArchetype(void) const
+		{
+			const auto signature =
+				Entity::getSignatureFromTypes<ComponentTypes...>();
+			for (const auto &archetype: _archetypes) {
+				if (archetype->getSignature() == signature) {
+					return archetype.get();
+				}
+			}
+			return nullptr;
+		}
+
 		/**
 		 * @brief Check whether any component stored for an entity has changed.
 		 * @param entityIdentifier The entity identifier.
@@ -224,9 +371,8 @@ namespace guillaume::ecs
 		 */
 		bool hasChanged(const Entity::Identifier &entityIdentifier) const
 		{
-			for (const auto &[typeIndex, storage]: _storages) {
-				(void)typeIndex;
-				if (storage->hasChanged(entityIdentifier)) {
+			for (const auto &storage: _storages) {
+				if (storage && storage->hasChanged(entityIdentifier)) {
 					return true;
 				}
 			}
@@ -234,14 +380,117 @@ namespace guillaume::ecs
 		}
 
 		/**
-		 * @brief Clear the changed flags for all stored components.
+		 * @brief Clear the changed flags of the components changed since the
+		 * last reset.
+		 *
+		 * Only the recorded changes are visited, so the cost scales with the
+		 * number of changes rather than the number of stored components.
 		 */
 		void resetChangedFlags(void)
 		{
-			for (auto &[typeIndex, storage]: _storages) {
-				(void)typeIndex;
-				storage->resetChangedFlags();
+			for (auto &storage: _storages) {
+				if (storage) {
+					storage->resetChangedFlags();
+				}
 			}
+			_changeTracker->clearPending();
+		}
+
+		/**
+		 * @brief Get the entities with a component changed since the last
+		 * reset.
+		 * @return Const reference to the identifiers, in change order and
+		 * without duplicates.
+		 * @note Entities changed while iterating are appended, so iterate by
+		 * index when the loop body may change components.
+		 */
+		const std::vector<Entity::Identifier> &getPendingChanges(void) const
+		{
+			return _changeTracker->getPendingEntities();
+		}
+
+		/**
+		 * @brief Get the current frame number.
+		 * @return The current frame number.
+		 */
+		Frame getFrame(void) const
+		{
+			return _changeTracker->getFrame();
+		}
+
+		/**
+		 * @brief Move on to the next frame, dropping handled changes and
+		 * removals older than ChangeHistoryLength frames.
+		 */
+		void advanceFrame(void)
+		{
+			_changeTracker->advanceFrame();
+			const Frame frame = _changeTracker->getFrame();
+			if (frame < ChangeHistoryLength) {
+				return;
+			}
+			for (auto &storage: _storages) {
+				if (storage) {
+					storage->getChangeLog().discardBefore(
+						frame - ChangeHistoryLength);
+					storage->getRemovalLog().discardBefore(
+						frame - ChangeHistoryLength);
+				}
+			}
+		}
+
+		/**
+		 * @brief Get the changes made to a component type during or after a
+		 * frame.
+		 * @tparam ComponentType The component type.
+		 * @param frame The first frame of interest.
+		 * @return View over the changes, oldest first, valid until the next
+		 * component change or advanceFrame().
+		 * @note Entries may refer to entities that no longer own the component.
+		 */
+		template<InheritFromComponent ComponentType>
+		std::span<const ChangeLog::Entry> getChangesSince(Frame frame) const
+		{
+			const auto *storage = findStorage<ComponentType>();
+			if (storage == nullptr) {
+				return {};
+			}
+			return storage->getChangeLog().getSince(frame);
+		}
+
+		/**
+		 * @brief Get the removals of a component type during or after a
+		 * frame.
+		 *
+		 * Destroying an entity removes each of its components, so it is
+		 * listed here too.
+		 * @tparam ComponentType The component type.
+		 * @param frame The first frame of interest.
+		 * @return View over the removals, oldest first, valid until the next
+		 * component removal or advanceFrame().
+		 * @note Entries may refer to entities that own the component again.
+		 */
+		template<InheritFromComponent ComponentType>
+		std::span<const ChangeLog::Entry> getRemovalsSince(Frame frame) const
+		{
+			const auto *storage = findStorage<ComponentType>();
+			if (storage == nullptr) {
+				return {};
+			}
+			return storage->getRemovalLog().getSince(frame);
+		}
+
+		/**
+		 * @brief Get the storage of a component type for dense iteration.
+		 * @tparam ComponentType The component type.
+		 * @return Reference to the storage, created if it does not exist yet.
+		 * @see ComponentStorage::getComponents
+		 * @see ComponentStorage::getIdentifiers
+		 */
+		template<InheritFromComponent ComponentType>
+		ComponentStorage<ComponentType> &getStorage(void)
+		{
+			return getOrCreateStorage<ComponentType>();
 		}
 
 		/**
@@ -277,15 +526,11 @@ namespace guillaume::ecs
 		template<InheritFromComponent ComponentType> const ComponentType &
 			getComponent(const Entity::Identifier &entityIdentifier) const
 		{
-			const std::type_index typeIndex(typeid(ComponentType));
-			auto iterator = _storages.find(typeIndex);
-			if (iterator == _storages.end()) {
+			const auto *storage = findStorage<ComponentType>();
+			if (storage == nullptr) {
 				throw EntityComponentNotFoundException<ComponentType>(
 					entityIdentifier);
 			}
-			const auto *storage =
-				static_cast<const ComponentStorage<ComponentType> *>(
-					iterator->second.get());
 			const auto *component = storage->find(entityIdentifier);
 			if (!component) {
 				throw EntityComponentNotFoundException<ComponentType>(
@@ -22,9 +22,16 @@
 
 #pragma once
 
-#include <unordered_map>
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <limits>
+#include <memory>
 #include <utility>
+#include <vector>
 
+#include "guillaume/ecs/change_log.hpp"
+#include "guillaume/ecs/change_tracker.hpp"
 #include "guillaume/ecs/component.hpp"
 #include "guillaume/ecs/entity.hpp"
 
@@ -37,6 +44,12 @@ namespace guillaume::ecs
 	class IComponentStorage
 	{
 		public:
+		/**
+		 * @brief Dense index value for entities without a component.
+		 */
+		constexpr static std::size_t InvalidIndex =
+			std::numeric_limits<std::size_t>::max();
+
 		/**
 		 * @brief Virtual destructor.
 		 */
@@ -64,14 +77,87 @@ namespace guillaume::ecs
 			hasChanged(const Entity::Identifier &entityIdentifier) const = 0;
 
 		/**
-		 * @brief Clear the changed flags for all components in this storage.
+		 * @brief Clear the changed flags of the components changed since the
+		 * last reset.
 		 */
 		virtual void resetChangedFlags(void) = 0;
+
+		/**
+		 * @brief Get the log of changes made to this storage's components.
+		 * @return Mutable reference to the change log.
+		 */
+		virtual ChangeLog &getChangeLog(void) = 0;
+
+		/**
+		 * @brief Get the log of changes made to this storage's components.
+		 * @return Const reference to the change log.
+		 */
+		virtual const ChangeLog &getChangeLog(void) const = 0;
+
+		/**
+		 * @brief Get the log of components removed from this storage.
+		 * @return Mutable reference to the removal log.
+		 */
+		virtual ChangeLog &getRemovalLog(void) = 0;
+
+		/**
+		 * @brief Get the log of components removed from this storage.
+		 * @return Const reference to the removal log.
+		 */
+		virtual const ChangeLog &getRemovalLog(void) const = 0;
+
+		/**
+		 * @brief Get the number of stored components.
+		 * @return The number of stored components.
+		 */
+		virtual std::size_t size(void) const = 0;
+
+		/**
+		 * @brief Grow the storage for upcoming components.
+		 * @param additional The number of components about to be added.
+		 */
+		virtual void reserve(std::size_t additional) = 0;
+
+		/**
+		 * @brief Get the identifiers of the entities owning a component, in
+		 * dense storage order.
+		 * @return Const reference to the packed identifier array.
+		 */
+		virtual const std::vector<Entity::Identifier> &
+			getIdentifiers(void) const = 0;
+
+		/**
+		 * @brief Get the dense index of an entity's component.
+		 * @param entityIdentifier The entity identifier.
+		 * @return The dense index, or InvalidIndex when the entity has no
+		 * component in this storage.
+		 */
+		virtual std::size_t
+			getIndex(const Entity::Identifier &entityIdentifier) const = 0;
+
+		/**
+		 * @brief Swap two packed components, keeping lookups consistent.
+		 * @param firstIndex Dense index of the first component.
+		 * @param secondIndex Dense index of the second component.
+		 */
+		virtual void swapIndices(std::size_t firstIndex,
+								 std::size_t secondIndex) = 0;
 	};
 
 	/**
-	 * @brief Storage for a single component type.
+	 * @brief Sparse-set storage for a single component type.
+	 *
+	 * Components are packed contiguously in a dense array, alongside a
+	 * parallel array of their owning entity identifiers. A paged sparse table
+	 * maps entity slots to their dense index, so lookups are a pair of array
+	 * accesses and systems can iterate all components linearly. The packed
+	 * identifier is compared on lookup, so a component left behind by a
+	 * destroyed entity is never returned for the entity reusing its slot.
+	 *
 	 * @tparam ComponentType The component type stored.
+	 * @note Removing a component moves the last component into the freed
+	 * slot, and adding one may grow the dense array: references and pointers
+	 * returned by this storage are invalidated by emplace() and remove().
 	 */
 	template<InheritFromComponent ComponentType> class ComponentStorage:
 		public IComponentStorage
@@ -80,10 +166,49 @@ namespace guillaume::ecs
 		/**
 		 * @brief Container type for components.
 		 */
-		using Storage = std::unordered_map<Entity::Identifier, ComponentType>;
+		using Storage = std::vector<ComponentType>;
+
+		/**
+		 * @brief Container type for the owning entity identifiers.
+		 */
+		using Identifiers = std::vector<Entity::Identifier>;
+
+		/**
+		 * @brief Number of sparse entries allocated at once.
+		 */
+		constexpr static std::size_t PageSize = 4096;
 
 		private:
-		Storage _components;
+		using Page = std::array<std::size_t, PageSize>;
+
+		Storage _components;	///< Packed components
+		Identifiers _identifiers;	 ///< Owner of each packed component
+		std::vector<std::unique_ptr<Page>>
+			_sparse;	///< Entity identifier to dense index pages
+		ChangeLog _changeLog;	 ///< Changes made to stored components
+		ChangeLog _removalLog {
+			nullptr, false
+		};	  ///< Components removed from the storage
+
+		/**
+		 * @brief Get the sparse entry of an entity, allocating its page if
+		 * needed.
+		 * @param entityIdentifier The entity identifier.
+		 * @return Mutable reference to the sparse entry.
+		 */
+		std::size_t &sparseEntry(const Entity::Identifier &entityIdentifier)
+		{
+			const Entity::Slot slot = Entity::getSlot(entityIdentifier);
+			const std::size_t page	= slot / PageSize;
+			if (page >= _sparse.size()) {
+				_sparse.resize(page + 1);
+			}
+			if (!_sparse[page]) {
+				_sparse[page] = std::make_unique<Page>();
+				_sparse[page]->fill(InvalidIndex);
+			}
+			return (*_sparse[page])[slot % PageSize];
+		}
 
 		public:
 		/**
@@ -91,6 +216,16 @@ namespace guillaume::ecs
 		 */
 		ComponentStorage(void) = default;
 
+		/**
+		 * @brief Construct a storage reporting changes to a tracker.
+		 * @param tracker The registry-wide change tracker.
+		 */
+		explicit ComponentStorage(ChangeTracker *tracker)
+			: _changeLog(tracker)
+			, _removalLog(tracker, false)
+		{
+		}
+
 		/**
 		 * @brief Default destructor.
 		 */
@@ -101,17 +236,24 @@ namespace guillaume::ecs
 		 * @param entityIdentifier The entity identifier.
 		 * @param args Arguments forwarded to the component constructor.
 		 * @return Reference to the stored component.
-		 * @note If a component already exists for the entity, it is replaced.
+		 * @note If a component already exists for the entity, or was left
+		 * behind by a destroyed entity with the same slot, it is replaced.
 		 */
 		template<typename... Args> ComponentType &
 			emplace(const Entity::Identifier &entityIdentifier, Args &&...args)
 		{
-			auto [iterator, inserted] = _components.emplace(
-				entityIdentifier, ComponentType(std::forward<Args>(args)...));
-			if (!inserted) {
-				iterator->second = ComponentType(std::forward<Args>(args)...);
+			std::size_t &index = sparseEntry(entityIdentifier);
+			if (index != InvalidIndex) {
+				_components[index] =
+					ComponentType(std::forward<Args>(args)...);
+				_identifiers[index] = entityIdentifier;
+			} else {
+				_components.emplace_back(std::forward<Args>(args)...);
+				_identifiers.push_back(entityIdentifier);
+				index = _components.size() - 1;
 			}
-			return iterator->second;
+			_components[index].attachChangeLog(&_changeLog, entityIdentifier);
+			return _components[index];
 		}
 
 		/**
@@ -122,11 +264,11 @@ namespace guillaume::ecs
 		 */
 		ComponentType *find(const Entity::Identifier &entityIdentifier)
 		{
-			auto iterator = _components.find(entityIdentifier);
-			if (iterator == _components.end()) {
+			const std::size_t index = getIndex(entityIdentifier);
+			if (index == InvalidIndex) {
 				return nullptr;
 			}
-			return &iterator->second;
+			return &_components[index];
 		}
 
 		/**
@@ -138,11 +280,11 @@ namespace guillaume::ecs
 		const ComponentType *
 			find(const Entity::Identifier &entityIdentifier) const
 		{
-			auto iterator = _components.find(entityIdentifier);
-			if (iterator == _components.end()) {
+			const std::size_t index = getIndex(entityIdentifier);
+			if (index == InvalidIndex) {
 				return nullptr;
 			}
-			return &iterator->second;
+			return &_components[index];
 		}
 
 		/**
@@ -151,7 +293,21 @@ namespace guillaume::ecs
 		 */
 		void remove(const Entity::Identifier &entityIdentifier) override
 		{
-			_components.erase(entityIdentifier);
+			const std::size_t index = getIndex(entityIdentifier);
+			if (index == InvalidIndex) {
+				return;
+			}
+
+			const std::size_t lastIndex = _components.size() - 1;
+			if (index != lastIndex) {
+				_components[index]	= std::move(_components[lastIndex]);
+				_identifiers[index] = _identifiers[lastIndex];
+				sparseEntry(_identifiers[index]) = index;
+			}
+			_components.pop_back();
+			_identifiers.pop_back();
+			sparseEntry(entityIdentifier) = InvalidIndex;
+			_removalLog.record(entityIdentifier);
 		}
 
 		/**
@@ -161,23 +317,116 @@ namespace guillaume::ecs
 		 */
 		bool has(const Entity::Identifier &entityIdentifier) const override
 		{
-			return _components.find(entityIdentifier) != _components.end();
+			return getIndex(entityIdentifier) != InvalidIndex;
 		}
 
 		bool hasChanged(
 			const Entity::Identifier &entityIdentifier) const override
 		{
-			auto iterator = _components.find(entityIdentifier);
-			return iterator != _components.end()
-				&& iterator->second.hasChanged();
+			const auto *component = find(entityIdentifier);
+			return component != nullptr && component->hasChanged();
 		}
 
 		void resetChangedFlags(void) override
 		{
-			for (auto &[entityIdentifier, component]: _components) {
-				(void)entityIdentifier;
-				component.setHasChanged(false);
+			for (const auto &entry: _changeLog.getPending()) {
+				if (auto *component = find(entry.identifier)) {
+					component->setHasChanged(false);
+				}
 			}
+			_changeLog.markHandled();
+		}
+
+		ChangeLog &getChangeLog(void) override
+		{
+			return _changeLog;
+		}
+
+		const ChangeLog &getChangeLog(void) const override
+		{
+			return _changeLog;
+		}
+
+		ChangeLog &getRemovalLog(void) override
+		{
+			return _removalLog;
+		}
+
+		const ChangeLog &getRemovalLog(void) const override
+		{
+			return _removalLog;
+		}
+
+		std::size_t size(void) const override
+		{
+			return _components.size();
+		}
+
+		void reserve(std::size_t additional) override
+		{
+			const std::size_t required = _components.size() + additional;
+			if (required <= _components.capacity()) {
+				return;
+			}
+			// Keep the geometric growth push_back would have had, so that
+			// repeated small reservations stay amortized constant.
+			const std::size_t capacity =
+				std::max(_components.capacity() * 2, required);
+			_components.reserve(capacity);
+			_identifiers.reserve(capacity);
+		}
+
+		const Identifiers &getIdentifiers(void) const override
+		{
+			return _identifiers;
+		}
+
+		std::size_t
+			getIndex(const Entity::Identifier &entityIdentifier) const override
+		{
+			const Entity::Slot slot = Entity::getSlot(entityIdentifier);
+			const std::size_t page	= slot / PageSize;
+			if (page >= _sparse.size() || !_sparse[page]) {
+				return InvalidIndex;
+			}
+			const std::size_t index = (*_sparse[page])[slot % PageSize];
+			if (index == InvalidIndex
+				|| _identifiers[index] != entityIdentifier) {
+				return InvalidIndex;
+			}
+			return index;
+		}
+
+		void swapIndices(std::size_t firstIndex,
+						 std::size_t secondIndex) override
+		{
+			if (firstIndex == secondIndex) {
+				return;
+			}
+			std::swap(_components[firstIndex], _components[secondIndex]);
+			std::swap(_identifiers[firstIndex], _identifiers[secondIndex]);
+			sparseEntry(_identifiers[firstIndex])  = firstIndex;
+			sparseEntry(_identifiers[secondIndex]) = secondIndex;
+		}
+
+		/**
+		 * @brief Get the packed components for dense iteration.
+		 * @return Mutable reference to the packed components, in the same
+		 * order as getIdentifiers().
+		 */
+		Storage &getComponents(void)
+		{
+			return _components;
+		}
+
+		/**
+		 * @brief Get the packed components for dense iteration (const).
+		 * @return Const reference to the packed components, in the same order
+		 * as getIdentifiers().
+		 */
+		const Storage &getComponents(void) const
+		{
+			return _components;
 		}
 	};
 
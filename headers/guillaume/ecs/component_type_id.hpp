@@ -22,9 +22,18 @@
 
 #pragma once
 
+#include <array>
+#include <concepts>
 #include <cstddef>
+#include <cstdint>
 #include <exception>
+#include <limits>
 #include <string>
+#include <string_view>
+
+#ifndef GUILLAUME_MAX_COMPONENT_TYPES
+	#define GUILLAUME_MAX_COMPONENT_TYPES 256
+#endif
 
 namespace guillaume::ecs
 {
@@ -32,8 +41,15 @@ namespace guillaume::ecs
 	/**
 	 * @brief Maximum number of distinct component types supported by
 	 * signatures.
+	 *
+	 * Configured with the GUILLAUME_MAX_COMPONENT_TYPES CMake cache variable.
+	 * Signatures hold one bit per type, so matching costs one word operation
+	 * per 64 types.
 	 */
-	constexpr std::size_t MaxComponentTypes = 64;
+	constexpr std::size_t MaxComponentTypes = GUILLAUME_MAX_COMPONENT_TYPES;
+
+	static_assert(MaxComponentTypes > 0 && MaxComponentTypes % 64 == 0,
+				  "MaxComponentTypes must be a positive multiple of 64");
 
 	/**
 	 * @brief Exception thrown when the component type limit is exceeded.
@@ -57,32 +73,145 @@ namespace guillaume::ecs
 	};
 
 	/**
-	 * @brief Monotonic component type id generator.
+	 * @brief Concept for types declaring the name their stable id hashes.
+	 * @tparam Type The type to check.
+	 */
+	template<typename Type>
+	concept HasStableName = requires {
+		{ Type::StableName } -> std::convertible_to<std::string_view>;
+	};
+
+	/**
+	 * @brief Component type id generator.
+	 *
+	 * Each component type gets two ids:
+	 * - a dense id, handed out on first use, indexing storages and
+	 *   signature bits. Registration is lock-free, but dense ids follow
+	 *   first-use order and must not be persisted;
+	 * - a stable id, a compile-time hash of the type name that is identical
+	 *   across runs of the same build, for snapshots and replay files.
+	 *   find() maps it back to the dense id of the running process.
+	 *
+	 * The hashed name is the type's StableName member when it declares one,
+	 * as the built-in components do. Otherwise it is the compiler's
+	 * spelling of the type, which differs between compilers and may change
+	 * between compiler versions: persist stable ids of such types only for
+	 * the toolchain that wrote them.
 	 * @see MaxComponentTypes
 	 * @see ComponentTypeLimitExceededException
 	 */
 	class ComponentTypeId
 	{
 		public:
+		using StableId = std::uint64_t;	   ///< Type alias for stable ids
+
 		/**
-		 * @brief Get a stable id for a component type.
+		 * @brief Dense id value for unknown types.
+		 */
+		constexpr static std::size_t InvalidId =
+			std::numeric_limits<std::size_t>::max();
+
+		private:
+		/**
+		 * @brief Hash a string with 64-bit FNV-1a.
+		 * @param text The string to hash.
+		 * @return The hash.
+		 */
+		constexpr static StableId hash(std::string_view text)
+		{
+			StableId value = 14695981039346656037ULL;
+			for (const char character: text) {
+				value ^= static_cast<unsigned char>(character);
+				value *= 1099511628211ULL;
+			}
+			return value;
+		}
+
+		/**
+		 * @brief Get the compiler's signature of this function, which spells
+		 * out the component type.
 		 * @tparam ComponentType The component type.
-		 * @return A stable id within [0, MaxComponentTypes).
+		 * @return The function signature.
+		 */
+		template<typename ComponentType>
+		constexpr static std::string_view getTypeSignature(void)
+		{
+#if defined(_MSC_VER)
+			return __FUNCSIG__;
+#else
+			return __PRETTY_FUNCTION__;
+#endif
+		}
+
+		public:
+		/**
+		 * @brief Get the dense id of a component type.
+		 * @tparam ComponentType The component type.
+		 * @return A stable id within [0, MaxComponentTypes) for this process.
 		 * @throws ComponentTypeLimitExceededException If the maximum number of
 		 * component types has been exceeded.
 		 */
 		template<typename ComponentType> static std::size_t get(void)
 		{
-			static const std::size_t id = nextId();
+			static const std::size_t id =
+				registerType(getStableId<ComponentType>());
 			return id;
 		}
 
+		/**
+		 * @brief Get the stable id of a component type.
+		 * @tparam ComponentType The component type.
+		 * @return The hash of the type's StableName, or of its compiler
+		 * spelling if it declares none, equal across runs of the same build.
+		 */
+		template<typename ComponentType>
+		constexpr static StableId getStableId(void)
+		{
+			if constexpr (HasStableName<ComponentType>) {
+				return hash(ComponentType::StableName);
+			} else {
+				return hash(getTypeSignature<ComponentType>());
+			}
+		}
+
+		/**
+		 * @brief Check at compile time that component types have distinct
+		 * stable ids.
+		 * @tparam ComponentTypes The component types.
+		 * @return True if no two stable ids collide.
+		 */
+		template<typename... ComponentTypes>
+		constexpr static bool areStableIdsUnique(void)
+		{
+			const std::array<StableId, sizeof...(ComponentTypes)> ids {
+				getStableId<ComponentTypes>()...
+			};
+			for (std::size_t first = 0; first < sizeof...(ComponentTypes);
+				 ++first) {
+				for (std::size_t second = first + 1;
+					 second < sizeof...(ComponentTypes); ++second) {
+					if (ids[first] == ids[second]) {
+						return false;
+					}
+				}
+			}
+			return true;
+		}
+
+		/**
+		 * @brief Find the dense id of a component type from its stable id.
+		 * @param stableId The stable id.
+		 * @return The dense id, or InvalidId if the type was not used yet.
+		 */
+		static std::size_t find(StableId stableId);
+
 		private:
 		/**
-		 * @brief Generate the next available id.
-		 * @return The next id.
+		 * @brief Hand out the next dense id.
+		 * @param stableId The stable id of the registered type.
+		 * @return The dense id.
 		 */
-		static std::size_t nextId(void);
+		static std::size_t registerType(StableId stableId);
 	};
 
 }	 // namespace guillaume::ecs
@@ -24,6 +24,8 @@
 
 #include <bitset>
 #include <cstddef>
+#include <cstdint>
+#include <new>
 
 #include "guillaume/ecs/component.hpp"
 #include "guillaume/ecs/component_type_id.hpp"
@@ -31,6 +33,8 @@
 namespace guillaume::ecs
 {
 
+	class EntityRegistry;
+
 	/**
 	 * @brief Non-template base class for entities in the ECS architecture.
 	 *
@@ -41,23 +45,82 @@ namespace guillaume::ecs
 	 */
 	class Entity
 	{
+		friend class EntityRegistry;
+
 		public:
 		using Identifier =
 			std::size_t;	///< Type alias for entity identifiers
-		using Signature =
-			std::bitset<64>;	///< Type alias for entity signatures
+		using Signature = std::bitset<
+			MaxComponentTypes>;	   ///< Type alias for entity signatures
+		using Slot = std::uint32_t;	   ///< Reusable part of an identifier
+		using Generation =
+			std::uint32_t;	  ///< Number of times a slot was reused
 
 		constexpr static Identifier InvalidIdentifier =
 			0;	  ///< Invalid identifier
 
 		private:
+		constexpr static std::size_t SlotBits =
+			32;	   ///< Low identifier bits holding the slot
+
 		/**
-		 * @brief Generate the next unique identifier for an entity.
-		 * @return The next unique identifier.
+		 * @brief Acquire an identifier, reusing the slot of a destroyed
+		 * entity when one is free.
+		 * @return An identifier not held by any living entity.
 		 */
-		static Identifier getNextIdentifier(void);
+		static Identifier acquireIdentifier(void);
+
+		/**
+		 * @brief Release an identifier, making its slot reusable under the
+		 * next generation.
+		 * @param identifier The identifier to release.
+		 */
+		static void releaseIdentifier(const Identifier &identifier);
 
 		public:
+		/**
+		 * @brief Build an identifier from a slot and a generation.
+		 * @param slot The slot.
+		 * @param generation The generation, never 0 for a valid identifier.
+		 * @return The identifier.
+		 */
+		constexpr static Identifier makeIdentifier(Slot slot,
+												   Generation generation)
+		{
+			return (static_cast<Identifier>(generation) << SlotBits) | slot;
+		}
+
+		/**
+		 * @brief Get the slot of an identifier.
+		 *
+		 * Slots are reused once their entity is destroyed, so they stay dense
+		 * and can index arrays directly.
+		 * @param identifier The identifier.
+		 * @return The slot.
+		 */
+		constexpr static Slot getSlot(const Identifier &identifier)
+		{
+			return static_cast<Slot>(identifier);
+		}
+
+		/**
+		 * @brief Get the generation of an identifier.
+		 * @param identifier The identifier.
+		 * @return The generation.
+		 */
+		constexpr static Generation getGeneration(const Identifier &identifier)
+		{
+			return static_cast<Generation>(identifier >> SlotBits);
+		}
+
+		/**
+		 * @brief Check whether an identifier belongs to a living entity.
+		 * @param identifier The identifier.
+		 * @return False once the entity is destroyed, even if its slot was
+		 * reused.
+		 */
+		static bool isAlive(const Identifier &identifier);
+
 		/**
 		 * @brief Generate a signature from the given component types.
 		 * @tparam NeededComponents The component types.
@@ -74,6 +137,7 @@ namespace guillaume::ecs
 		private:
 		const Identifier _identifier;	 ///< Unique identifier
 		Signature _signature;			 ///< Entity signature
+		EntityRegistry *_owner { nullptr };	   ///< Registry owning the entity
 
 		protected:
 		/**
@@ -84,7 +148,7 @@ namespace guillaume::ecs
 		 */
 		template<InheritFromComponent... ComponentTypes> void setSignature(void)
 		{
-			_signature = getSignatureFromTypes<ComponentTypes...>();
+			setSignature(getSignatureFromTypes<ComponentTypes...>());
 		}
 
 		public:
@@ -94,9 +158,54 @@ namespace guillaume::ecs
 		Entity(void);
 
 		/**
-		 * @brief Default destructor for the Entity class.
+		 * @brief Entities are identified by their address in their registry
+		 * and cannot be copied.
 		 */
-		virtual ~Entity(void) = default;
+		Entity(const Entity &) = delete;
+
+		/**
+		 * @brief Entities cannot be copied.
+		 */
+		Entity &operator=(const Entity &) = delete;
+
+		/**
+		 * @brief Destructor, releasing the entity's identifier.
+		 */
+		virtual ~Entity(void);
+
+		/**
+		 * @brief Allocate an entity from the shared EntityPool.
+		 * @param size The size of the most derived entity type.
+		 * @return Pointer to the allocated memory.
+		 */
+		static void *operator new(std::size_t size);
+
+		/**
+		 * @brief Return an entity's memory to the shared EntityPool.
+		 * @param pointer The memory to release.
+		 * @param size The size of the most derived entity type.
+		 */
+		static void operator delete(void *pointer, std::size_t size);
+
+		/**
+		 * @brief Allocate an over-aligned entity.
+		 * @param size The size of the most derived entity type.
+		 * @param alignment The alignment of the most derived entity type.
+		 * @return Pointer to the allocated memory.
+		 * @see EntityPool::allocate
+		 */
+		static void *operator new(std::size_t size,
+								  std::align_val_t alignment);
+
+		/**
+		 * @brief Release the memory of an over-aligned entity.
+		 * @param pointer The memory to release.
+		 * @param size The size of the most derived entity type.
+		 * @param alignment The alignment of the most derived entity type.
+		 */
+		static void operator delete(void *pointer,
+									std::size_t size,
+									std::align_val_t alignment);
 
 		/**
 		 * @brief Get the unique identifier of the entity.
@@ -112,6 +221,9 @@ namespace guillaume::ecs
 
 		/**
 		 * @brief Set the entity's signature.
+		 *
+		 * The owning registry hierarchy is notified so its cached queries
+		 * stay in sync.
 		 * @param signature The new signature.
 		 */
 		void setSignature(const Signature &signature);
@@ -124,6 +236,22 @@ namespace guillaume::ecs
 		 * their component data changes.
 		 */
 		virtual void update(void);
+
+		/**
+		 * @brief Get the registry holding the entity's children.
+		 * @return Pointer to the registry.
+		 * @retval nullptr The entity cannot own children.
+		 * @see ParentEntity
+		 */
+		virtual EntityRegistry *asEntityRegistry(void);
+
+		/**
+		 * @brief Get the registry holding the entity's children (const).
+		 * @return Pointer to the registry.
+		 * @retval nullptr The entity cannot own children.
+		 * @see ParentEntity
+		 */
+		virtual const EntityRegistry *asEntityRegistry(void) const;
 	};
 
 	/**
@@ -0,0 +1,229 @@
+/*
+ Copyright (c) 2026 ETIB Corporation
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy of
+ this software and associated documentation files (the "Software"), to deal in
+ the Software without restriction, including without limitation the rights to
+ use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ of the Software, and to permit persons to whom the Software is furnished to do
+ so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in all
+ copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ SOFTWARE.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <unordered_map>
+#include <vector>
+
+#include "guillaume/ecs/entity.hpp"
+
+namespace guillaume::ecs
+{
+
+	/**
+	 * @brief Flattened entity hierarchy stored in contiguous arrays.
+	 *
+	 * Every entity is a node linked to its parent, first child and siblings
+	 * by index, and RootNode stands for the owning registry. Nodes are
+	 * recycled when entities are removed. Depth-first and breadth-first
+	 * traversals follow the links without inspecting the dynamic type of
+	 * entities, and allocate nothing once the breadth-first queue has grown
+	 * to the size of the hierarchy.
+	 * @see EntityRegistry
+	 */
+	class EntityHierarchy
+	{
+		public:
+		using Node = std::uint32_t;	   ///< Index of a node in the arrays
+
+		/**
+		 * @brief Node value for missing links.
+		 */
+		constexpr static Node InvalidNode = std::numeric_limits<Node>::max();
+
+		/**
+		 * @brief Node standing for the owning registry.
+		 */
+		constexpr static Node RootNode = 0;
+
+		private:
+		std::vector<Entity *> _entities;	///< Entity of each node
+		std::vector<Node> _parents;			///< Parent of each node
+		std::vector<Node> _firstChildren;	 ///< First child of each node
+		std::vector<Node> _lastChildren;	///< Last child of each node
+		std::vector<Node> _previousSiblings;	///< Previous sibling
+		std::vector<Node> _nextSiblings;		///< Next sibling
+		std::vector<std::uint32_t> _depths;	   ///< Depth below RootNode
+		std::vector<std::uint64_t>
+			_insertionOrders;	 ///< Rank of each node among its siblings
+		std::uint64_t _nextInsertionOrder { 0 };	///< Next rank handed out
+		std::vector<Node> _freeNodes;	 ///< Nodes of removed entities
+		std::unordered_map<Entity::Identifier, Node>
+			_nodes;	   ///< Node of each entity, by identifier
+		mutable std::vector<Node>
+			_breadthFirstQueue;	   ///< Reused queue of forEachBreadthFirst()
+
+		/**
+		 * @brief Get the next node in pre-order within a subtree.
+		 * @param node The current node.
+		 * @param subtree The root of the traversed subtree.
+		 * @return The next node, or InvalidNode at the end of the subtree.
+		 */
+		Node getNextPreOrder(Node node, Node subtree) const
+		{
+			if (_firstChildren[node] != InvalidNode) {
+				return _firstChildren[node];
+			}
+			while (node != subtree && _nextSiblings[node] == InvalidNode) {
+				node = _parents[node];
+			}
+			return node == subtree ? InvalidNode : _nextSiblings[node];
+		}
+
+		public:
+		/**
+		 * @brief Construct a hierarchy holding only the root node.
+		 */
+		EntityHierarchy(void);
+
+		/**
+		 * @brief Default destructor.
+		 */
+		~EntityHierarchy(void) = default;
+
+		/**
+		 * @brief Append an entity as the last child of a node.
+		 * @param parent The parent node.
+		 * @param entity The entity to append.
+		 * @return The node of the entity.
+		 */
+		Node insert(Node parent, Entity &entity);
+
+		/**
+		 * @brief Grow the arrays for upcoming entities.
+		 * @param additional The number of entities about to be inserted.
+		 */
+		void reserve(std::size_t additional);
+
+		/**
+		 * @brief Remove a node and its descendants.
+		 * @param node The node to remove, other than RootNode.
+		 */
+		void erase(Node node);
+
+		/**
+		 * @brief Find the node of an entity.
+		 * @param entityIdentifier The entity identifier.
+		 * @return The node, or InvalidNode if the entity is not listed.
+		 */
+		Node find(const Entity::Identifier &entityIdentifier) const;
+
+		/**
+		 * @brief Get the entity of a node.
+		 * @param node The node, other than RootNode.
+		 * @return Reference to the entity.
+		 */
+		Entity &getEntity(Node node) const;
+
+		/**
+		 * @brief Get the parent of a node.
+		 * @param node The node.
+		 * @return The parent node, or InvalidNode for RootNode.
+		 */
+		Node getParent(Node node) const;
+
+		/**
+		 * @brief Get the first child of a node.
+		 * @param node The node.
+		 * @return The first child, or InvalidNode if the node has none.
+		 */
+		Node getFirstChild(Node node) const;
+
+		/**
+		 * @brief Get the next sibling of a node.
+		 * @param node The node.
+		 * @return The next sibling, or InvalidNode for the last child.
+		 */
+		Node getNextSibling(Node node) const;
+
+		/**
+		 * @brief Compare two nodes in breadth-first order.
+		 *
+		 * Shallower nodes come first; nodes at the same depth are ordered by
+		 * their ancestors, then by the order they were added to their
+		 * parent. The cost grows with the depth of the nodes, not with the
+		 * size of the hierarchy.
+		 * @param first The first node, other than RootNode.
+		 * @param second The second node, other than RootNode.
+		 * @return True if forEachBreadthFirst() visits first before second.
+		 */
+		bool isBreadthFirstBefore(Node first, Node second) const;
+
+		/**
+		 * @brief Get the number of listed entities.
+		 * @return The number of entities.
+		 */
+		std::size_t size(void) const;
+
+		/**
+		 * @brief Visit the descendants of a node in depth-first pre-order.
+		 * @tparam Callback Callable taking an Entity reference.
+		 * @param node The node whose descendants are visited.
+		 * @param callback The function called for each descendant.
+		 * @note The callback must not add or remove entities.
+		 */
+		template<typename Callback>
+		void forEachDepthFirst(Node node, Callback &&callback) const
+		{
+			for (Node current = _firstChildren[node]; current != InvalidNode;
+				 current = getNextPreOrder(current, node)) {
+				callback(*_entities[current]);
+			}
+		}
+
+		/**
+		 * @brief Visit every entity in breadth-first order.
+		 *
+		 * The queue is a member reused across traversals, so the walk is
+		 * linear and does not allocate once it has grown to the size of the
+		 * hierarchy. A callback may start another traversal, which
+		 * queues past the current one.
+		 * @tparam Callback Callable taking an Entity reference.
+		 * @param callback The function called for each entity.
+		 * @note The callback must not add or remove entities, and
+		 * traversals of one hierarchy must not run concurrently.
+		 */
+		template<typename Callback>
+		void forEachBreadthFirst(Callback &&callback) const
+		{
+			const std::size_t start = _breadthFirstQueue.size();
+			_breadthFirstQueue.push_back(RootNode);
+			for (std::size_t index = start; index < _breadthFirstQueue.size();
+				 ++index) {
+				const Node node = _breadthFirstQueue[index];
+				if (node != RootNode) {
+					callback(*_entities[node]);
+				}
+				for (Node child = _firstChildren[node]; child != InvalidNode;
+					 child = _nextSiblings[child]) {
+					_breadthFirstQueue.push_back(child);
+				}
+			}
+			_breadthFirstQueue.resize(start);
+		}
+	};
+
+}	 // namespace guillaume::ecs
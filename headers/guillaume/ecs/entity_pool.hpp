@@ -0,0 +1,164 @@
+/*
+ Copyright (c) 2026 ETIB Corporation
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy of
+ this software and associated documentation files (the "Software"), to deal in
+ the Software without restriction, including without limitation the rights to
+ use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ of the Software, and to permit persons to whom the Software is furnished to do
+ so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in all
+ copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ SOFTWARE.
+ */
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <vector>
+
+namespace guillaume::ecs
+{
+
+	/**
+	 * @brief Size-class pool backing the allocation of entity objects.
+	 *
+	 * Entities are carved out of large blocks holding many objects of the
+	 * same size, so entities built by the same builder sit next to each
+	 * other in memory. Freed objects go back to a per-size free list and are
+	 * reused by the next entity of that size, so destroying and rebuilding a
+	 * scene does not go through the system allocator. Objects larger than
+	 * MaxPooledSize, or aligned on more than Granularity, use the global
+	 * allocator. Blocks are kept once allocated: call trim() after tearing
+	 * down a large scene to give the fully free ones back to the system.
+	 * @see Entity::operator new
+	 */
+	class EntityPool
+	{
+		public:
+		/**
+		 * @brief Size granularity and alignment of pooled objects.
+		 */
+		constexpr static std::size_t Granularity =
+			alignof(std::max_align_t);
+
+		/**
+		 * @brief Largest object size served by the pool.
+		 */
+		constexpr static std::size_t MaxPooledSize = 1024;
+
+		/**
+		 * @brief Number of objects carved out of each block.
+		 */
+		constexpr static std::size_t ObjectsPerBlock = 256;
+
+		private:
+		/**
+		 * @brief Free object, linked in place to the next free one.
+		 */
+		struct FreeObject {
+			FreeObject *next;	 ///< Next free object of the same size
+		};
+
+		/**
+		 * @brief Blocks and free objects of one object size.
+		 */
+		struct SizeClass {
+			FreeObject *freeObjects { nullptr };	///< Objects to reuse
+			std::vector<std::unique_ptr<std::byte[]>>
+				blocks;	   ///< Memory carved into objects of this size
+		};
+
+		mutable std::mutex _mutex;	  ///< Guards concurrent entity creation
+		std::array<SizeClass, MaxPooledSize / Granularity>
+			_sizeClasses;	 ///< Size classes, by size in granules minus one
+
+		/**
+		 * @brief Get the size class index of an object size.
+		 * @param size The object size, at most MaxPooledSize.
+		 * @return The size class index.
+		 */
+		static std::size_t getSizeClassIndex(std::size_t size);
+
+		public:
+		/**
+		 * @brief Default constructor.
+		 */
+		EntityPool(void) = default;
+
+		/**
+		 * @brief Default destructor.
+		 */
+		~EntityPool(void) = default;
+
+		/**
+		 * @brief Get the pool shared by all entities.
+		 * @return Reference to the pool, never destroyed.
+		 */
+		static EntityPool &getInstance(void);
+
+		/**
+		 * @brief Allocate memory for an object.
+		 * @param size The object size.
+		 * @return Pointer to memory aligned on Granularity.
+		 * @throws std::bad_alloc If memory is exhausted.
+		 */
+		void *allocate(std::size_t size);
+
+		/**
+		 * @brief Allocate memory for an object with an alignment requirement.
+		 * @param size The object size.
+		 * @param alignment The object alignment.
+		 * @return Pointer to memory aligned on alignment.
+		 * @throws std::bad_alloc If memory is exhausted.
+		 */
+		void *allocate(std::size_t size, std::align_val_t alignment);
+
+		/**
+		 * @brief Release memory returned by allocate().
+		 * @param pointer The memory to release.
+		 * @param size The size passed to allocate().
+		 */
+		void deallocate(void *pointer, std::size_t size);
+
+		/**
+		 * @brief Release memory returned by allocate() with an alignment.
+		 * @param pointer The memory to release.
+		 * @param size The size passed to allocate().
+		 * @param alignment The alignment passed to allocate().
+		 */
+		void deallocate(void *pointer,
+						std::size_t size,
+						std::align_val_t alignment);
+
+		/**
+		 * @brief Give the blocks whose objects are all free back to the
+		 * system allocator.
+		 *
+		 * Runs in time proportional to the number of free objects, so call
+		 * it after tearing down a scene rather than every frame.
+		 * @return The number of released blocks.
+		 */
+		std::size_t trim(void);
+
+		/**
+		 * @brief Get the number of blocks allocated for an object size.
+		 * @param size The object size.
+		 * @return The number of blocks, 0 for sizes above MaxPooledSize.
+		 */
+		std::size_t getBlockCount(std::size_t size) const;
+	};
+
+}	 // namespace guillaume::ecs
@@ -0,0 +1,190 @@
+/*
+ Copyright (c) 2026 ETIB Corporation
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy of
+ this software and associated documentation files (the "Software"), to deal in
+ the Software without restriction, including without limitation the rights to
+ use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ of the Software, and to permit persons to whom the Software is furnished to do
+ so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in all
+ copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ SOFTWARE.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <limits>
+#include <span>
+#include <vector>
+
+#include "guillaume/ecs/entity.hpp"
+#include "guillaume/ecs/entity_hierarchy.hpp"
+
+namespace guillaume::ecs
+{
+
+	/**
+	 * @brief Cached list of the entities matching a signature.
+	 *
+	 * Queries are owned by an EntityRegistry and kept up to date as entities
+	 * are added to its hierarchy or change signature, so systems can iterate
+	 * the matching entities without walking the hierarchy every frame.
+	 * Entities are listed in breadth-first hierarchy order, as
+	 * EntityRegistry::getEntityWithSignature() lists them: shallower entities
+	 * first, and siblings in the order they were added. Systems drawing in
+	 * query order rely on it to paint parents under their children.
+	 * Entities that start matching are inserted at their breadth-first
+	 * position, found by binary search, and a sparse index by entity slot
+	 * finds listed entities without scanning the list.
+	 * @see EntityRegistry::getQuery
+	 */
+	class EntityQuery
+	{
+		public:
+		using Identifiers =
+			std::vector<Entity::Identifier>;	///< Matching identifiers
+
+		/**
+		 * @brief Position returned for entities the query does not list.
+		 */
+		constexpr static std::size_t InvalidPosition =
+			std::numeric_limits<std::size_t>::max();
+
+		private:
+		Entity::Signature _signature;	 ///< Signature entities must include
+		Identifiers _identifiers;		 ///< Matching entity identifiers
+		std::vector<std::size_t>
+			_positions;	   ///< Position of each listed entity, by slot
+		std::size_t _insertionCount { 0 };	  ///< Entities inserted so far
+
+		/**
+		 * @brief List an entity at its breadth-first position.
+		 * @param entityIdentifier The entity identifier, not yet listed.
+		 * @param hierarchy The hierarchy listing the entity.
+		 */
+		void place(const Entity::Identifier &entityIdentifier,
+				   const EntityHierarchy &hierarchy);
+
+		/**
+		 * @brief Remove the entity at a position.
+		 * @param position The position of the entity.
+		 */
+		void removeAt(std::size_t position);
+
+		/**
+		 * @brief Record the positions of the entities from a position on.
+		 * @param position The first position to record.
+		 */
+		void reindexFrom(std::size_t position);
+
+		public:
+		/**
+		 * @brief Construct an empty query.
+		 * @param signature The signature matching entities must include.
+		 */
+		explicit EntityQuery(const Entity::Signature &signature);
+
+		/**
+		 * @brief Default destructor.
+		 */
+		~EntityQuery(void) = default;
+
+		/**
+		 * @brief Get the query signature.
+		 * @return The signature matching entities must include.
+		 */
+		const Entity::Signature &getSignature(void) const;
+
+		/**
+		 * @brief Check whether an entity signature matches the query.
+		 * @param signature The entity signature.
+		 * @return True if the signature includes the query signature.
+		 */
+		bool matches(const Entity::Signature &signature) const;
+
+		/**
+		 * @brief Get the matching entity identifiers.
+		 * @return Const reference to the matching identifiers.
+		 */
+		const Identifiers &getIdentifiers(void) const;
+
+		/**
+		 * @brief Get the number of matching entities.
+		 * @return The number of matching entities.
+		 */
+		std::size_t size(void) const;
+
+		/**
+		 * @brief Get the position of an entity in the query.
+		 * @param entityIdentifier The entity identifier.
+		 * @return The index of the entity in getIdentifiers(), or
+		 * InvalidPosition if the query does not list it.
+		 */
+		std::size_t
+			getPosition(const Entity::Identifier &entityIdentifier) const;
+
+		/**
+		 * @brief Get the number of entities inserted since the query was
+		 * created.
+		 *
+		 * The count never decreases, so comparing it before and after a loop
+		 * tells whether entities started matching meanwhile.
+		 * @return The number of insertions.
+		 */
+		std::size_t getInsertionCount(void) const;
+
+		/**
+		 * @brief Collect the listed entities missing from a sorted list.
+		 * @param sortedIdentifiers The entity identifiers, sorted in
+		 * ascending order.
+		 * @param missing Vector the missing entities are appended to, in
+		 * query order.
+		 */
+		void collectMissing(
+			std::span<const Entity::Identifier> sortedIdentifiers,
+			Identifiers &missing) const;
+
+		/**
+		 * @brief Record a newly added entity if it matches.
+		 * @param entity The added entity.
+		 * @param hierarchy The hierarchy listing the entity.
+		 */
+		void insert(const Entity &entity, const EntityHierarchy &hierarchy);
+
+		/**
+		 * @brief Re-evaluate an entity whose signature changed.
+		 * @param entity The entity already part of the queried hierarchy.
+		 * @param hierarchy The hierarchy listing the entity.
+		 */
+		void refresh(const Entity &entity, const EntityHierarchy &hierarchy);
+
+		/**
+		 * @brief Forget an entity.
+		 * @param entityIdentifier The entity identifier.
+		 */
+		void erase(const Entity::Identifier &entityIdentifier);
+
+		/**
+		 * @brief Forget several entities in a single pass.
+		 * @param sortedIdentifiers The entity identifiers, sorted in
+		 * ascending order.
+		 */
+		void erase(std::span<const Entity::Identifier> sortedIdentifiers);
+
+		/**
+		 * @brief Forget every entity.
+		 */
+		void clear(void);
+	};
+
+}	 // namespace guillaume::ecs
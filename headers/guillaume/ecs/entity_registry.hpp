@@ -22,24 +22,88 @@
 
 #pragma once
 
+#include <cstddef>
 #include <memory>
-#include <queue>
 #include <vector>
 
 #include "guillaume/ecs/entity.hpp"
+#include "guillaume/ecs/entity_hierarchy.hpp"
+#include "guillaume/ecs/entity_query.hpp"
 
 namespace guillaume::ecs
 {
 
+	class ComponentRegistry;
+
 	/**
 	 * @brief Abstract base class for containers that own ECS entities.
 	 *
 	 * This contract unifies entity ownership for scene-level registries and
-	 * hierarchy-capable entities. Traversal helpers process the hierarchy in
-	 * breadth-first order.
+	 * hierarchy-capable entities. Each registry keeps its whole hierarchy
+	 * flattened in an EntityHierarchy, so traversals and lookups neither
+	 * walk nested registries nor allocate. An entity is therefore indexed
+	 * once per registry above it: memory and insertion cost grow with the
+	 * nesting depth, which stays shallow in user interfaces, in exchange
+	 * for queries and lookups on any nested registry.
+	 *
+	 * Each registry also owns cached queries over its hierarchy. They are
+	 * updated when entities are added or destroyed anywhere below the
+	 * registry or when a descendant changes its signature.
 	 */
 	class EntityRegistry
 	{
+		friend class Entity;
+
+		private:
+		EntityRegistry *_parentRegistry { nullptr };	///< Owner, if nested
+		Entity *_registryEntity {
+			nullptr
+		};	  ///< Entity owning this registry, if nested
+		std::vector<std::unique_ptr<EntityQuery>>
+			_queries;	 ///< Cached queries over this hierarchy
+		EntityHierarchy _hierarchy;	   ///< Every entity of this hierarchy
+
+		/**
+		 * @brief Get the node of a registry in this registry's hierarchy.
+		 * @param registry This registry or a registry nested below it.
+		 * @return The node standing for the registry.
+		 */
+		EntityHierarchy::Node
+			findRegistryNode(const EntityRegistry &registry) const;
+
+		/**
+		 * @brief Record an entity and its descendants in the hierarchy and
+		 * the cached queries.
+		 * @param parent The node of the registry owning the entity.
+		 * @param entity The root of the subtree to record.
+		 */
+		void indexSubtree(EntityHierarchy::Node parent, Entity &entity);
+
+		/**
+		 * @brief Forget an entity and its descendants in the hierarchy and
+		 * the cached queries.
+		 * @param node The node of the entity.
+		 * @param sortedIdentifiers The identifiers of the entity and its
+		 * descendants, sorted in ascending order.
+		 */
+		void unindexSubtree(
+			EntityHierarchy::Node node,
+			const std::vector<Entity::Identifier> &sortedIdentifiers);
+
+		/**
+		 * @brief Propagate a signature change to the cached queries of this
+		 * registry and of every registry above it.
+		 * @param entity The entity whose signature changed.
+		 */
+		void onEntitySignatureChanged(const Entity &entity);
+
+		/**
+		 * @brief Fill a query with the matching entities in breadth-first
+		 * order.
+		 * @param query The query to fill.
+		 */
+		void fillQuery(EntityQuery &query) const;
+
 		protected:
 		/**
 		 * @brief Access mutable direct child entities owned by this registry.
@@ -72,6 +136,27 @@ namespace guillaume::ecs
 		 */
 		void addEntity(std::unique_ptr<Entity> entity);
 
+		/**
+		 * @brief Grow the registry for upcoming direct entities.
+		 * @param additional The number of entities about to be added.
+		 */
+		void reserveEntities(std::size_t additional);
+
+		/**
+		 * @brief Destroy an entity of this hierarchy and its descendants.
+		 *
+		 * The entities are removed from their registry, the cached queries
+		 * and every component storage, then their identifiers are released
+		 * for reuse under a new generation.
+		 * @param entityIdentifier The identifier of the entity to destroy.
+		 * @param componentRegistry The registry holding the entities'
+		 * components.
+		 * @return True if the entity was found and destroyed.
+		 * @note Do not destroy entities while iterating over their registry.
+		 */
+		bool destroyEntity(const Entity::Identifier &entityIdentifier,
+						   ComponentRegistry &componentRegistry);
+
 		/**
 		 * @brief Get all registered entities.
 		 * @return Const reference to registered entities.
@@ -81,6 +166,21 @@ namespace guillaume::ecs
 			return accessDirectEntities();
 		}
 
+		/**
+		 * @brief Get the flattened hierarchy of this registry.
+		 *
+		 * Prefer its forEachDepthFirst() and forEachBreadthFirst() helpers
+		 * over getEntitiesBreadthFirst(), which copies the entities.
+		 * @return Const reference to the hierarchy.
+		 */
+		const EntityHierarchy &getHierarchy(void) const;
+
+		/**
+		 * @brief Get the number of entities in this registry hierarchy.
+		 * @return The number of entities, descendants included.
+		 */
+		std::size_t getEntityCount(void) const;
+
 		/**
 		 * @brief Collect all entities in this registry hierarchy using BFS.
 		 * @return Entity pointers in breadth-first traversal order.
@@ -104,5 +204,29 @@ namespace guillaume::ecs
 		 */
 		std::vector<Entity::Identifier>
 			getEntityWithSignature(Entity::Signature systemSignature) const;
+
+		/**
+		 * @brief Get the cached query matching the specified signature.
+		 *
+		 * The query is built on first request and then kept up to date, so
+		 * repeated calls neither traverse the hierarchy nor allocate while
+		 * no matching entity is added. Its entities are listed in the
+		 * breadth-first order of getEntityWithSignature(): entities that
+		 * start matching are inserted at their position in that order.
+		 * @param signature The signature to match against entities.
+		 * @return Reference to the query, valid for the registry lifetime.
+		 * @note Entities added while iterating may be inserted anywhere in
+		 * the query; compare EntityQuery::getInsertionCount() before and
+		 * after the loop to find out whether any was.
+		 */
+		const EntityQuery &getQuery(Entity::Signature signature);
+
+		/**
+		 * @brief Find an entity of this hierarchy by identifier.
+		 * @param entityIdentifier The entity identifier.
+		 * @return Pointer to the entity or nullptr.
+		 * @retval nullptr No entity of this hierarchy has the identifier.
+		 */
+		Entity *findEntity(const Entity::Identifier &entityIdentifier) const;
 	};
 }	 // namespace guillaume::ecs
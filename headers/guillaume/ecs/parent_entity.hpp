@@ -63,6 +63,17 @@ namespace guillaume::ecs
 		{
 			return _children;
 		}
+
+		public:
+		EntityRegistry *asEntityRegistry(void) override
+		{
+			return this;
+		}
+
+		const EntityRegistry *asEntityRegistry(void) const override
+		{
+			return this;
+		}
 	};
 
 }	 // namespace guillaume::ecs
@@ -24,6 +24,7 @@
 
 #include <bitset>
 #include <functional>
+#include <span>
 #include <stdexcept>
 #include <vector>
 
@@ -35,7 +36,11 @@
 #include "guillaume/ecs/component_registry.hpp"
 #include "guillaume/ecs/component_type_id.hpp"
 #include "guillaume/ecs/entity.hpp"
+#include "guillaume/ecs/entity_query.hpp"
 #include "guillaume/ecs/entity_registry.hpp"
+#include "guillaume/ecs/thread_pool.hpp"
+
+#include "guillaume/logging.hpp"
 
 namespace guillaume::ecs
 {
@@ -72,9 +77,21 @@ namespace guillaume::ecs
 		private:
 		Phase _phase;					 ///< Update phase of the system
 		Entity::Signature _signature;	 ///< System signature
+		Entity::Signature
+			_writeSignature;	///< Components written by the system
+		bool _isExclusive {
+			false
+		};	  ///< Whether the system must run alone in its phase
 		ecs::ComponentRegistry *_activeComponentRegistry {
 			nullptr
 		};	  ///< Active component registry for the current update scope
+		ThreadPool *_threadPool {
+			nullptr
+		};	  ///< Pool used by parallelFor(), if any
+		std::vector<Entity::Identifier>
+			_batch;	   ///< Reused snapshot of the entities being updated
+		std::vector<Entity::Identifier>
+			_updatedEntities;	 ///< Entities already updated, sorted
 
 		protected:
 		/**
@@ -87,8 +104,27 @@ namespace guillaume::ecs
 		{
 			_signature.reset();
 			(_signature.set(ComponentTypeId::get<ComponentTypes>()), ...);
+			_writeSignature = _signature;
 		}
 
+		/**
+		 * @brief Set the system's signature and the components it writes.
+		 * @param signature The components an entity must own to be updated.
+		 * @param writeSignature The components the system modifies; the other
+		 * components of the signature are only read.
+		 */
+		void setAccess(const Entity::Signature &signature,
+					   const Entity::Signature &writeSignature);
+
+		/**
+		 * @brief Declare whether the system must run alone in its phase.
+		 *
+		 * Systems driving a shared resource such as the renderer, changing
+		 * the entity hierarchy or running user callbacks are exclusive.
+		 * @param isExclusive New exclusive state.
+		 */
+		void setExclusive(bool isExclusive);
+
 		/**
 		 * @brief Get the active component registry for the current update
 		 * scope.
@@ -153,6 +189,42 @@ namespace guillaume::ecs
 				entityIdentifier);
 		}
 
+		/**
+		 * @brief Get the storage of a component type from the active component
+		 * registry.
+		 * @tparam ComponentType The component type.
+		 * @return Mutable reference to the packed component storage, which
+		 * can be iterated densely.
+		 */
+		template<InheritFromComponent ComponentType>
+		ComponentStorage<ComponentType> &getStorage(void)
+		{
+			return getComponentRegistry().getStorage<ComponentType>();
+		}
+
+		/**
+		 * @brief Split a range into chunks and process them on the thread
+		 * pool, or inline when the system has none.
+		 * @param count Number of indices.
+		 * @param chunkSize Maximum number of indices per chunk.
+		 * @param body Body invoked with the [begin, end) bounds of each chunk,
+		 * possibly concurrently.
+		 * @note The body must not log, add entities or touch the renderer.
+		 */
+		void parallelFor(std::size_t count, std::size_t chunkSize,
+						 const ThreadPool::RangeBody &body);
+
+		/**
+		 * @brief Resolve the storages used by the system for the current
+		 * update scope.
+		 *
+		 * Called by run() once the component registry is bound, before any
+		 * entity is updated. The default implementation does nothing.
+		 * @param componentRegistry The component registry bound to the
+		 * update scope.
+		 */
+		virtual void bindStorages(ecs::ComponentRegistry &componentRegistry);
+
 		/**
 		 * @brief Ensure a component exists for an entity and log if missing.
 		 * @tparam ComponentType The required component type.
@@ -201,6 +273,64 @@ namespace guillaume::ecs
 		 */
 		Entity::Signature getSignature(void) const;
 
+		/**
+		 * @brief Get the components the system modifies.
+		 * @return The write signature.
+		 */
+		Entity::Signature getWriteSignature(void) const;
+
+		/**
+		 * @brief Get the components the system only reads.
+		 * @return The read signature.
+		 */
+		Entity::Signature getReadSignature(void) const;
+
+		/**
+		 * @brief Check whether the system must run alone in its phase.
+		 * @return True if the system is exclusive.
+		 */
+		bool isExclusive(void) const;
+
+		/**
+		 * @brief Check whether two systems may not run concurrently.
+		 * @param other The other system.
+		 * @return True if either system is exclusive or writes a component
+		 * the other one accesses.
+		 */
+		bool conflictsWith(const System &other) const;
+
+		/**
+		 * @brief Update the entities whose components changed since the last
+		 * reset, then clear the changed flags.
+		 *
+		 * Entities are updated in breadth-first hierarchy order, parents
+		 * before their children, whatever the order they changed in.
+		 * @param componentRegistry The component registry instance.
+		 * @param entityRegistry The entity registry owning the entities.
+		 */
+		static void
+			applyPendingChanges(ecs::ComponentRegistry &componentRegistry,
+								ecs::EntityRegistry &entityRegistry);
+
+		/**
+		 * @brief Create the storages of the components accessed by the
+		 * system.
+		 *
+		 * Called before systems run concurrently, so that no storage is
+		 * created while another system reads the registry.
+		 * @param componentRegistry The component registry instance.
+		 */
+		virtual void prepareStorages(ecs::ComponentRegistry &componentRegistry);
+
+		/**
+		 * @brief Update every entity of a query.
+		 * @param componentRegistry The component registry instance.
+		 * @param query The query listing the entities to update.
+		 * @note Unlike routine(), pending component changes are not applied.
+		 */
+		void run(ecs::ComponentRegistry &componentRegistry,
+				 const EntityQuery &query);
+
 		/**
 		 * @brief Routine to update all managed entities.
 		 * @param componentRegistry The component registry instance.
@@ -210,12 +340,42 @@ namespace guillaume::ecs
 		void routine(ecs::ComponentRegistry &componentRegistry,
 					 ecs::EntityRegistry &entityRegistry);
 
+		/**
+		 * @brief Set the thread pool used by parallelFor().
+		 * @param threadPool The thread pool, or nullptr to run inline.
+		 */
+		void setThreadPool(ThreadPool *threadPool);
+
 		/**
 		 * @brief Update the system, processing relevant entities.
 		 * @param entityIdentifier The identifier of the entity to update.
 		 */
 		virtual void
 			update(const ecs::Entity::Identifier &entityIdentifier) = 0;
+
+		/**
+		 * @brief Update a batch of matching entities.
+		 *
+		 * The default implementation calls update() for each entity. Systems
+		 * with a hot loop override it to resolve their storages once and
+		 * walk the components directly.
+		 * @param entities The identifiers of the entities to update, stable
+		 * for the whole call even if entities are added meanwhile.
+		 */
+		virtual void
+			updateBatch(std::span<const Entity::Identifier> entities);
+
+		/**
+		 * @brief Update the entities of a query.
+		 *
+		 * Called by run() once the storages are bound. The default
+		 * implementation hands updateBatch() a copy of the query, then, if
+		 * entities started matching meanwhile, a copy of those not updated
+		 * yet, until none is inserted. Systems that do not walk their
+		 * entities override it to skip the copy.
+		 * @param query The query listing the entities to update.
+		 */
+		virtual void updateQuery(const EntityQuery &query);
 	};
 
 	/**
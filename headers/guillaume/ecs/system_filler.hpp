@@ -22,22 +22,307 @@
 
 #pragma once
 
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
 #include "guillaume/ecs/component.hpp"
+#include "guillaume/ecs/component_registry.hpp"
+#include "guillaume/ecs/entity.hpp"
 #include "guillaume/ecs/system.hpp"
 
 namespace guillaume::ecs
 {
 
+	/**
+	 * @brief SystemFiller argument listing components a system only reads.
+	 * @tparam ComponentTypes The read component types.
+	 */
+	template<InheritFromComponent... ComponentTypes> struct Reads {
+	};
+
+	/**
+	 * @brief SystemFiller argument listing components a system modifies.
+	 * @tparam ComponentTypes The written component types.
+	 */
+	template<InheritFromComponent... ComponentTypes> struct Writes {
+	};
+
+	/**
+	 * @brief Access declared by a SystemFiller argument.
+	 *
+	 * A bare component type is conservatively considered written.
+	 * @tparam ComponentType The component type.
+	 */
+	template<typename ComponentType> struct SystemAccess {
+		/**
+		 * @brief Components accessed.
+		 */
+		using Components = std::tuple<ComponentType>;
+
+		/**
+		 * @brief Components written.
+		 */
+		using WrittenComponents = std::tuple<ComponentType>;
+
+		/**
+		 * @brief Get the components accessed.
+		 * @return The accessed components signature.
+		 */
+		static Entity::Signature getSignature(void)
+		{
+			return Entity::getSignatureFromTypes<ComponentType>();
+		}
+
+		/**
+		 * @brief Get the components written.
+		 * @return The written components signature.
+		 */
+		static Entity::Signature getWriteSignature(void)
+		{
+			return getSignature();
+		}
+
+		/**
+		 * @brief Create the storages of the accessed components.
+		 * @param componentRegistry The component registry.
+		 */
+		static void prepareStorages(ComponentRegistry &componentRegistry)
+		{
+			componentRegistry.getStorage<ComponentType>();
+		}
+	};
+
+	/**
+	 * @brief Access declared by a Reads list.
+	 * @tparam ComponentTypes The read component types.
+	 */
+	template<InheritFromComponent... ComponentTypes>
+	struct SystemAccess<Reads<ComponentTypes...>> {
+		using Components		= std::tuple<ComponentTypes...>;
+		using WrittenComponents = std::tuple<>;
+
+		static Entity::Signature getSignature(void)
+		{
+			return Entity::getSignatureFromTypes<ComponentTypes...>();
+		}
+
+		static Entity::Signature getWriteSignature(void)
+		{
+			return Entity::Signature();
+		}
+
+		static void prepareStorages(ComponentRegistry &componentRegistry)
+		{
+			(componentRegistry.getStorage<ComponentTypes>(), ...);
+		}
+	};
+
+	/**
+	 * @brief Access declared by a Writes list.
+	 * @tparam ComponentTypes The written component types.
+	 */
+	template<InheritFromComponent... ComponentTypes>
+	struct SystemAccess<Writes<ComponentTypes...>> {
+		using Components		= std::tuple<ComponentTypes...>;
+		using WrittenComponents = std::tuple<ComponentTypes...>;
+
+		static Entity::Signature getSignature(void)
+		{
+			return Entity::getSignatureFromTypes<ComponentTypes...>();
+		}
+
+		static Entity::Signature getWriteSignature(void)
+		{
+			return getSignature();
+		}
+
+		static void prepareStorages(ComponentRegistry &componentRegistry)
+		{
+			(componentRegistry.getStorage<ComponentTypes>(), ...);
+		}
+	};
+
+	/**
+	 * @brief Trait detecting Reads and Writes lists.
+	 * @tparam Type The type to check.
+	 */
+	template<typename Type> struct IsAccessList: std::false_type {
+	};
+
+	template<InheritFromComponent... ComponentTypes>
+	struct IsAccessList<Reads<ComponentTypes...>>: std::true_type {
+	};
+
+	template<InheritFromComponent... ComponentTypes>
+	struct IsAccessList<Writes<ComponentTypes...>>: std::true_type {
+	};
+
+	/**
+	 * @brief Trait checking whether a tuple lists a type.
+	 * @tparam Type The type to look for.
+	 * @tparam Tuple The std::tuple to search.
+	 */
+	template<typename Type, typename Tuple> struct TupleContains;
+
+	template<typename Type, typename... Types>
+	struct TupleContains<Type, std::tuple<Types...>>:
+		std::disjunction<std::is_same<Type, Types>...> {
+	};
+
+	/**
+	 * @brief Trait mapping a tuple of component types to a tuple of
+	 * pointers to their storages.
+	 * @tparam Tuple The std::tuple of component types.
+	 */
+	template<typename Tuple> struct StoragePointers;
+
+	template<typename... ComponentTypes>
+	struct StoragePointers<std::tuple<ComponentTypes...>> {
+		/**
+		 * @brief Tuple of storage pointers.
+		 */
+		using Type = std::tuple<ComponentStorage<ComponentTypes> *...>;
+	};
+
+	/**
+	 * @brief Concept for SystemFiller arguments: component types or
+	 * Reads/Writes lists.
+	 * @tparam Type The type to check.
+	 */
+	template<typename Type>
+	concept SystemFillerArgument =
+		InheritFromComponent<Type> || IsAccessList<Type>::value;
+
 	/**
 	 * @brief Templated System class that automatically sets its signature based
 	 * on the specified component types.
-	 * @tparam ComponentTypes The component types that define the system's
-	 * signature.
+	 *
+	 * Components can be wrapped in Reads<...> or Writes<...> to declare how
+	 * the system accesses them; bare components are considered written. The
+	 * SystemScheduler runs systems with non-conflicting access concurrently.
+	 *
+	 * The storages of the declared components are resolved once per update
+	 * scope; findComponent() then reaches a component through its storage's
+	 * sparse index, without registry lookup or exception. Components only
+	 * read are returned const, and components not declared do not compile.
+	 *
+	 * @code
+	 * class Outline
+	 *     : public ecs::SystemFiller<ecs::Reads<components::Transform>,
+	 *                                ecs::Writes<components::Borders>> {
+	 *     // ...
+	 * };
+	 * @endcode
+	 *
+	 * @tparam Arguments The component types or access lists that define the
+	 * system's signature.
 	 * @see System
+	 * @see SystemScheduler
 	 */
-	template<InheritFromComponent... ComponentTypes> class SystemFiller:
+	template<SystemFillerArgument... Arguments> class SystemFiller:
 		public System
 	{
+		public:
+		/**
+		 * @brief Components accessed by the system.
+		 */
+		using Components = decltype(std::tuple_cat(
+			std::declval<typename SystemAccess<Arguments>::Components>()...));
+
+		/**
+		 * @brief Components written by the system.
+		 */
+		using WrittenComponents = decltype(std::tuple_cat(
+			std::declval<
+				typename SystemAccess<Arguments>::WrittenComponents>()...));
+
+		/**
+		 * @brief Whether the system declares a component type.
+		 * @tparam ComponentType The component type.
+		 */
+		template<typename ComponentType>
+		constexpr static bool Accesses =
+			TupleContains<ComponentType, Components>::value;
+
+		/**
+		 * @brief Whether the system declares writing a component type.
+		 * @tparam ComponentType The component type.
+		 */
+		template<typename ComponentType>
+		constexpr static bool Modifies =
+			TupleContains<ComponentType, WrittenComponents>::value;
+
+		/**
+		 * @brief Component type as seen by the system: const unless written.
+		 * @tparam ComponentType The component type.
+		 */
+		template<typename ComponentType>
+		using Access = std::conditional_t<Modifies<ComponentType>,
+										  ComponentType, const ComponentType>;
+
+		private:
+		typename StoragePointers<Components>::Type
+			_boundStorages {};	  ///< Storages of the current update scope
+
+		/**
+		 * @brief Point a storage pointer at the registry's storage.
+		 * @tparam ComponentType The component type.
+		 * @param storage The storage pointer to set.
+		 * @param componentRegistry The component registry.
+		 */
+		template<InheritFromComponent ComponentType>
+		static void bindStorage(ComponentStorage<ComponentType> *&storage,
+								ComponentRegistry &componentRegistry)
+		{
+			storage = &componentRegistry.getStorage<ComponentType>();
+		}
+
+		protected:
+		void bindStorages(ComponentRegistry &componentRegistry) override
+		{
+			std::apply(
+				[&componentRegistry](auto *&...storages) {
+					(bindStorage(storages, componentRegistry), ...);
+				},
+				_boundStorages);
+		}
+
+		/**
+		 * @brief Get the storage of a declared component type for the
+		 * current update scope.
+		 * @tparam ComponentType The component type.
+		 * @return Reference to the storage, const unless the component is
+		 * written.
+		 * @note Only valid while the system runs.
+		 */
+		template<InheritFromComponent ComponentType>
+		std::conditional_t<Modifies<ComponentType>,
+						   ComponentStorage<ComponentType> &,
+						   const ComponentStorage<ComponentType> &>
+			getBoundStorage(void) const
+		{
+			static_assert(Accesses<ComponentType>,
+						  "Component type not declared by the system");
+			return *std::get<ComponentStorage<ComponentType> *>(
+				_boundStorages);
+		}
+
+		/**
+		 * @brief Find a declared component of an entity.
+		 * @tparam ComponentType The component type.
+		 * @param entityIdentifier The entity identifier.
+		 * @return Pointer to the component, const unless the component is
+		 * written.
+		 * @retval nullptr The entity does not own the component.
+		 * @note Only valid while the system runs.
+		 */
+		template<InheritFromComponent ComponentType> Access<ComponentType> *
+			findComponent(const Entity::Identifier &entityIdentifier) const
+		{
+			return getBoundStorage<ComponentType>().find(entityIdentifier);
+		}
+
 		public:
 		/**
 		 * @brief Construct a new System Filler object and set its signature.
@@ -47,13 +332,21 @@ namespace guillaume::ecs
 		SystemFiller(System::Phase phase)
 			: System(phase)
 		{
-			setSignature<ComponentTypes...>();
+			setAccess((Entity::Signature() | ...
+					   | SystemAccess<Arguments>::getSignature()),
+					  (Entity::Signature() | ...
+					   | SystemAccess<Arguments>::getWriteSignature()));
 		}
 
 		/**
 		 * @brief Default destructor for the SystemFiller class.
 		 */
 		virtual ~SystemFiller(void) = default;
+
+		void prepareStorages(ComponentRegistry &componentRegistry) override
+		{
+			(SystemAccess<Arguments>::prepareStorages(componentRegistry), ...);
+		}
 	};
 
 }	 // namespace guillaume::ecs
\ No newline at end of file
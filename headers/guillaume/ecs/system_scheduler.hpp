@@ -0,0 +1,116 @@
+/*
+ Copyright (c) 2026 ETIB Corporation
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy of
+ this software and associated documentation files (the "Software"), to deal in
+ the Software without restriction, including without limitation the rights to
+ use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ of the Software, and to permit persons to whom the Software is furnished to do
+ so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in all
+ copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ SOFTWARE.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <map>
+#include <vector>
+
+#include <utility/logging/loggable.hpp>
+#include <utility/logging/standard_logger.hpp>
+
+#include "guillaume/ecs/component_registry.hpp"
+#include "guillaume/ecs/entity_query.hpp"
+#include "guillaume/ecs/entity_registry.hpp"
+#include "guillaume/ecs/system.hpp"
+#include "guillaume/ecs/system_registry.hpp"
+#include "guillaume/ecs/thread_pool.hpp"
+
+namespace guillaume::ecs
+{
+
+	/**
+	 * @brief Runs the systems of a phase, concurrently where their declared
+	 * component access allows it.
+	 *
+	 * Within a phase, each system depends on the previously registered
+	 * systems it conflicts with (see System::conflictsWith). Systems are
+	 * grouped into waves: a wave only holds mutually independent systems and
+	 * comes after the waves of all the systems it depends on. Waves run in
+	 * order, and the systems of a wave run concurrently on the thread pool.
+	 * Pending component changes are applied before each wave.
+	 * @see SystemFiller
+	 */
+	class SystemScheduler:
+		protected utility::logging::Loggable<SystemScheduler,
+											 utility::logging::StandardLogger>
+	{
+		public:
+		using Wave = std::vector<System *>;	   ///< Independent systems
+
+		private:
+		/**
+		 * @brief Cached waves of a phase.
+		 */
+		struct Schedule {
+			std::size_t systemCount { 0 };	  ///< Systems when last built
+			std::vector<Wave> waves;		  ///< Waves in execution order
+		};
+
+		const SystemRegistry &_systemRegistry;	  ///< Scheduled systems
+		ThreadPool &_threadPool;	///< Pool running concurrent systems
+		std::map<System::Phase, Schedule> _schedules;	 ///< Waves per phase
+		std::vector<const EntityQuery *>
+			_queries;	 ///< Queries of the wave being run
+
+		/**
+		 * @brief Group the systems of a phase into waves.
+		 * @param systems The systems of the phase, in registration order.
+		 * @return The waves in execution order.
+		 */
+		static std::vector<Wave>
+			buildWaves(const std::vector<std::unique_ptr<System>> &systems);
+
+		public:
+		/**
+		 * @brief Construct a scheduler.
+		 * @param systemRegistry The registry holding the systems to run.
+		 * @param threadPool The pool running concurrent systems.
+		 */
+		SystemScheduler(const SystemRegistry &systemRegistry,
+						ThreadPool &threadPool);
+
+		/**
+		 * @brief Default destructor.
+		 */
+		~SystemScheduler(void) = default;
+
+		/**
+		 * @brief Get the waves of a phase, rebuilding them if systems were
+		 * registered since the last call.
+		 * @param phase The phase.
+		 * @return The waves in execution order.
+		 */
+		const std::vector<Wave> &getWaves(System::Phase phase);
+
+		/**
+		 * @brief Run every system of a phase.
+		 * @param phase The phase to run.
+		 * @param componentRegistry The active component registry.
+		 * @param entityRegistry The active entity registry.
+		 */
+		void run(System::Phase phase, ComponentRegistry &componentRegistry,
+				 EntityRegistry &entityRegistry);
+	};
+
+}	 // namespace guillaume::ecs
@@ -0,0 +1,162 @@
+/*
+ Copyright (c) 2026 ETIB Corporation
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy of
+ this software and associated documentation files (the "Software"), to deal in
+ the Software without restriction, including without limitation the rights to
+ use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ of the Software, and to permit persons to whom the Software is furnished to do
+ so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in all
+ copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ SOFTWARE.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace guillaume::ecs
+{
+
+	/**
+	 * @brief Work-stealing thread pool running indexed jobs.
+	 *
+	 * Each worker owns a job queue: it pops its own jobs from the back and
+	 * steals from the front of the other queues when it runs dry. The thread
+	 * calling parallelFor() takes part in the work until its jobs complete,
+	 * so nested calls cannot deadlock.
+	 */
+	class ThreadPool
+	{
+		public:
+		using Body =
+			std::function<void(std::size_t)>;	 ///< Job body, given an index
+		using RangeBody = std::function<void(
+			std::size_t, std::size_t)>;	   ///< Job body, given [begin, end)
+
+		private:
+		/**
+		 * @brief Completion state shared by the jobs of a parallelFor() call.
+		 */
+		struct Batch {
+			std::mutex mutex;					 ///< Guards the fields below
+			std::condition_variable completed;	  ///< Signaled when done
+			std::size_t remaining { 0 };		  ///< Jobs not finished yet
+			std::exception_ptr exception;		  ///< First job failure
+		};
+
+		/**
+		 * @brief A single body invocation.
+		 */
+		struct Job {
+			const Body *body { nullptr };	 ///< Body to invoke
+			std::size_t index { 0 };		 ///< Index given to the body
+			Batch *batch { nullptr };		 ///< Batch to report to
+		};
+
+		/**
+		 * @brief Job queue owned by a worker.
+		 */
+		struct Queue {
+			std::mutex mutex;		   ///< Guards the jobs
+			std::deque<Job> jobs;	 ///< Queued jobs
+		};
+
+		std::vector<std::unique_ptr<Queue>> _queues;	///< One per worker
+		std::vector<std::thread> _workers;			  ///< Worker threads
+		std::atomic<std::size_t> _queuedJobs { 0 };	   ///< Jobs in queues
+		std::mutex _sleepMutex;	   ///< Guards worker sleep
+		std::condition_variable _wakeUp;	///< Signaled on new jobs
+		bool _isStopping { false };			///< Set on destruction
+
+		/**
+		 * @brief Take a job, from the given queue first, then from others.
+		 * @param queueIndex Preferred queue, or the queue count for none.
+		 * @param job Receives the taken job.
+		 * @return True if a job was taken.
+		 */
+		bool takeJob(std::size_t queueIndex, Job &job);
+
+		/**
+		 * @brief Run a job and report its completion to its batch.
+		 * @param job The job to run.
+		 */
+		static void execute(const Job &job);
+
+		/**
+		 * @brief Worker thread loop.
+		 * @param queueIndex Index of the worker's own queue.
+		 */
+		void work(std::size_t queueIndex);
+
+		public:
+		/**
+		 * @brief Get the default number of workers.
+		 * @return One less than the hardware concurrency, since the calling
+		 * thread also runs jobs.
+		 */
+		static std::size_t getDefaultWorkerCount(void);
+
+		/**
+		 * @brief Start the worker threads.
+		 * @param workerCount Number of worker threads; with none, jobs run on
+		 * the calling thread.
+		 */
+		explicit ThreadPool(std::size_t workerCount = getDefaultWorkerCount());
+
+		/**
+		 * @brief Stop and join the worker threads.
+		 */
+		~ThreadPool(void);
+
+		ThreadPool(const ThreadPool &)			  = delete;
+		ThreadPool &operator=(const ThreadPool &) = delete;
+
+		/**
+		 * @brief Get the number of worker threads.
+		 * @return The number of worker threads.
+		 */
+		std::size_t getWorkerCount(void) const;
+
+		/**
+		 * @brief Invoke a body for every index in [0, count) and wait.
+		 * @param count Number of indices.
+		 * @param body Body invoked once per index, possibly concurrently.
+		 * @throw Rethrows the first exception thrown by the body, once every
+		 * index has been processed.
+		 */
+		void parallelFor(std::size_t count, const Body &body);
+
+		/**
+		 * @brief Split [0, count) into chunks, invoke a body per chunk and
+		 * wait.
+		 * @param count Number of indices.
+		 * @param chunkSize Maximum number of indices per chunk.
+		 * @param body Body invoked with the [begin, end) bounds of each chunk,
+		 * possibly concurrently.
+		 * @throw Rethrows the first exception thrown by the body, once every
+		 * chunk has been processed.
+		 */
+		void parallelForChunks(std::size_t count, std::size_t chunkSize,
+							   const RangeBody &body);
+	};
+
+}	 // namespace guillaume::ecs
@@ -325,6 +325,27 @@ namespace guillaume::entities
 			   Shape shape, Size size, bool isMorph,
 			   std::function<void(void)> onClick);
 
+		/**
+		 * @brief Buttons cannot be copied: their Interaction handlers capture
+		 * the address of the button.
+		 */
+		Button(const Button &) = delete;
+
+		/**
+		 * @brief Buttons cannot be moved, for the same reason.
+		 */
+		Button(Button &&) = delete;
+
+		/**
+		 * @brief Buttons cannot be copied.
+		 */
+		Button &operator=(const Button &) = delete;
+
+		/**
+		 * @brief Buttons cannot be moved.
+		 */
+		Button &operator=(Button &&) = delete;
+
 		/**
 		 * @brief Default destructor for the Button entity.
 		 */
@@ -22,26 +22,56 @@
 
 #pragma once
 
+#include <cstddef>
 #include <functional>
-#include <map>
 #include <memory>
-#include <typeindex>
+#include <mutex>
+#include <stdexcept>
 #include <vector>
 
 #include <utility/event/event.hpp>
 
+#include "guillaume/event/event_pool.hpp"
+#include "guillaume/event/event_ring.hpp"
+#include "guillaume/event/event_type_id.hpp"
+
 namespace guillaume::event
 {
 
+	/**
+	 * @brief How the EventBus delivers the events of a type.
+	 */
+	enum class CoalescingPolicy {
+		KeepAll,	   ///< Deliver every event as soon as it is published
+		LatestWins,	   ///< Deliver only the last event published before
+					   ///< flush()
+		Accumulate	   ///< Merge the events published before flush() into
+					   ///< one
+	};
+
 	/**
 	 * @brief Routes events to subscribed listeners.
 	 *
+	 * Every listener subscribed to the type of a published event receives
+	 * it. The event is shared between them and immutable, so fanning it out
+	 * only copies a pointer.
+	 *
+	 * Event types can be coalesced: their events are held by the bus and
+	 * delivered once per flush(), so high-frequency samples such as motion
+	 * do not reach every subscriber queue.
+	 *
+	 * Routes are stored in a flat table indexed by EventTypeId, so
+	 * publishing finds the listeners of an event without a map lookup.
+	 *
 	 * @code
 	 * event::EventBus bus;
-	 * bus.subscribe<utility::event::KeyboardEvent>(
-	 *     [](std::unique_ptr<utility::event::Event> event) {
+	 * auto subscription = bus.subscribe<utility::event::KeyboardEvent>(
+	 *     [](const event::EventBus::EventPointer &event) {
 	 *         // Handle keyboard event.
 	 *     });
+	 * bus.unsubscribe(subscription);
+	 * bus.setCoalescingPolicy<utility::event::MouseMotionEvent>(
+	 *     event::CoalescingPolicy::LatestWins);
 	 * @endcode
 	 *
 	 * @see EventSubscriber
@@ -50,24 +80,98 @@ namespace guillaume::event
 	class EventBus
 	{
 		public:
-		using Listener = std::function<void(
-			std::unique_ptr<utility::event::Event>)>;	 ///< Event listener
-														 ///< type
-		using ListenerList =
-			std::vector<Listener>;	  ///< List of event listeners
+		using EventPointer = std::shared_ptr<
+			const utility::event::Event>;	 ///< Shared immutable event
+		using Listener =
+			std::function<void(const EventPointer &)>;	  ///< Event listener
+														  ///< type
+		using SubscriptionId =
+			std::size_t;	///< Identifies a listener for unsubscribe()
+
+		/**
+		 * @brief Merges an event into the accumulated one.
+		 * @tparam EventType The event type.
+		 */
+		template<utility::event::InheritFromEvent EventType>
+		using Merge = std::function<void(EventType &, const EventType &)>;
 
 		private:
-		std::map<std::type_index, ListenerList>
-			_typedListeners;	///< Per-type listeners
+		/**
+		 * @brief Events held for a coalesced type until the next flush().
+		 */
+		struct PendingEvents {
+			CoalescingPolicy policy {
+				CoalescingPolicy::KeepAll
+			};	  ///< Coalescing policy of the type
+			EventRing<EventPointer> latest {
+				2, OverflowPolicy::Coalesce
+			};	  ///< Last events published, for LatestWins
+			std::mutex mutex;	 ///< Guards accumulated, for Accumulate
+			std::shared_ptr<utility::event::Event>
+				accumulated;	///< Merged events, for Accumulate
+			std::function<void(std::shared_ptr<utility::event::Event> &,
+							   const utility::event::Event &)>
+				accumulate;	   ///< Merges an event, copying the first one
+		};
+
+		/**
+		 * @brief A listener and its subscription id.
+		 */
+		struct Subscription {
+			SubscriptionId id;	  ///< Id returned by subscribe()
+			Listener listener;	  ///< Subscribed listener
+		};
+
+		using ListenerList =
+			std::vector<Subscription>;	  ///< List of event listeners
+
+		/**
+		 * @brief Listeners and coalescing state of an event type.
+		 */
+		struct Route {
+			ListenerList listeners;	   ///< Subscribed listeners
+			std::unique_ptr<PendingEvents>
+				pending;	///< Held events, if the type is coalesced
+		};
+
+		std::vector<Route> _routes;	   ///< Routes, indexed by EventTypeId
+		SubscriptionId _nextSubscriptionId {
+			0
+		};	  ///< Id given to the next listener
 
 		/**
 		 * @brief Dispatch an event to a list of listeners.
 		 * @param event Event to dispatch.
 		 * @param listeners List of listeners to notify.
 		 */
-		void dispatchToListeners(std::unique_ptr<utility::event::Event> event,
+		void dispatchToListeners(const EventPointer &event,
 								 ListenerList &listeners);
 
+		/**
+		 * @brief Get the route of an event type, creating it if needed.
+		 * @param typeId The EventTypeId of the type.
+		 * @return The route of the type.
+		 */
+		Route &getRoute(std::size_t typeId);
+
+		/**
+		 * @brief Subscribe a listener to an event type.
+		 * @param typeId The EventTypeId of the type.
+		 * @param listener Listener to notify for matching events.
+		 * @return The id of the subscription.
+		 */
+		SubscriptionId subscribe(std::size_t typeId,
+								 const Listener &listener);
+
+		/**
+		 * @brief Set how the events of a type are delivered.
+		 * @param typeId The EventTypeId of the type.
+		 * @param policy The coalescing policy.
+		 * @return The pending events of the type, or nullptr for KeepAll.
+		 */
+		PendingEvents *setCoalescingPolicy(std::size_t typeId,
+										   CoalescingPolicy policy);
+
 		public:
 		/**
 		 * @brief Default constructor.
@@ -80,21 +184,83 @@ namespace guillaume::event
 		~EventBus(void) = default;
 
 		/**
-		 * @brief Dispatch an event to listeners and systems.
-		 * @param event Event to dispatch (ownership transferred).
-		 * @note Listeners take ownership of the event instance.
+		 * @brief Dispatch an event to every listener of its type, or hold it
+		 * until flush() if the type is coalesced.
+		 * @param event Event to dispatch, ideally created by makeEvent() so
+		 * its memory is recycled; a std::unique_ptr transfers its
+		 * ownership.
+		 * @note Listeners share the event instance and may keep it.
+		 * @note Safe to call from several threads at once, as long as no
+		 * listener subscribes or unsubscribes and no policy changes
+		 * meanwhile. Accumulated types take a short lock; the others are
+		 * lock-free.
 		 */
-		void publish(std::unique_ptr<utility::event::Event> event);
+		void publish(EventPointer event);
+
+		/**
+		 * @brief Deliver the events held for coalesced types.
+		 *
+		 * Called once per frame by the application, before systems run.
+		 */
+		void flush(void);
 
 		/**
 		 * @brief Subscribe a listener to a specific event type.
 		 * @tparam EventType The type of event to subscribe to.
-		 * @param listener Listener to notify for matching events.
+		 * @param listener Listener to notify for matching events, possibly
+		 * from the thread publishing the event.
+		 * @return The id to pass to unsubscribe() before the listener's
+		 * captures are destroyed.
+		 */
+		template<utility::event::InheritFromEvent EventType>
+		SubscriptionId subscribe(const Listener &listener)
+		{
+			return subscribe(EventTypeId::get<EventType>(), listener);
+		}
+
+		/**
+		 * @brief Remove a listener.
+		 * @param subscription The id returned by subscribe().
+		 * @return True if the listener was removed, false if it was not
+		 * subscribed.
+		 */
+		bool unsubscribe(SubscriptionId subscription);
+
+		/**
+		 * @brief Set how the events of a type are delivered.
+		 * @tparam EventType The event type.
+		 * @param policy The coalescing policy.
+		 * @param merge For Accumulate, merges an event into the accumulated
+		 * one, which starts as a copy of the first event since the last
+		 * flush().
+		 * @throws std::invalid_argument If the policy is Accumulate and no
+		 * merge function is given.
 		 */
 		template<utility::event::InheritFromEvent EventType>
-		void subscribe(const Listener &listener)
+		void setCoalescingPolicy(CoalescingPolicy policy,
+								 Merge<EventType> merge = {})
 		{
-			_typedListeners[typeid(EventType)].push_back(listener);
+			if (policy == CoalescingPolicy::Accumulate && !merge) {
+				throw std::invalid_argument(
+					"Accumulated events need a merge function");
+			}
+			auto *pending =
+				setCoalescingPolicy(EventTypeId::get<EventType>(), policy);
+			if (pending == nullptr || !merge) {
+				return;
+			}
+			pending->accumulate =
+				[merge = std::move(merge)](
+					std::shared_ptr<utility::event::Event> &accumulated,
+					const utility::event::Event &event) {
+					const auto &typedEvent =
+						static_cast<const EventType &>(event);
+					if (!accumulated) {
+						accumulated = makeEvent<EventType>(typedEvent);
+						return;
+					}
+					merge(static_cast<EventType &>(*accumulated), typedEvent);
+				};
 		}
 	};
 
@@ -39,6 +39,8 @@ namespace guillaume::event
 	 * This class provides an abstract interface for handling events in the
 	 * Guillaume framework. Implementations should poll or process
 	 * platform-specific events and convert them to Guillaume Event objects.
+	 * Creating events with makeEvent() recycles their memory through the
+	 * EventPool once every subscriber has consumed them.
 	 *
 	 * @code
 	 * class MyEventHandler : public event::EventHandler {
@@ -46,7 +48,7 @@ namespace guillaume::event
 	 *     void pollEvents(void) override {
 	 *         // Convert platform events to utility::event::Event and call
 	 * callback.
-	 *         // getEventCallback()(event);
+	 *         // getEventCallback()(event::makeEvent<QuitEvent>());
 	 *     }
 	 * };
 	 * @endcode
@@ -58,9 +60,10 @@ namespace guillaume::event
 											 utility::logging::StandardLogger>
 	{
 		public:
+		using EventPointer = std::shared_ptr<
+			const utility::event::Event>;	 ///< Shared, immutable event
 		using Handler =
-			std::function<void(std::unique_ptr<utility::event::Event>
-								   &)>;	   ///< Event handler type
+			std::function<void(EventPointer)>;	  ///< Event handler type
 
 		private:
 		Handler _callback;	   ///< Event callback function
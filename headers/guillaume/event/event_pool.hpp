@@ -0,0 +1,196 @@
+/*
+ Copyright (c) 2026 ETIB Corporation
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy of
+ this software and associated documentation files (the "Software"), to deal in
+ the Software without restriction, including without limitation the rights to
+ use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ of the Software, and to permit persons to whom the Software is furnished to do
+ so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in all
+ copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ SOFTWARE.
+ */
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <utility>
+
+#include <utility/event/event.hpp>
+
+#include "guillaume/event/event_ring.hpp"
+
+namespace guillaume::event
+{
+
+	/**
+	 * @brief Size-class pool recycling the memory of events.
+	 *
+	 * Events are allocated together with their shared_ptr control block
+	 * through makeEvent(). When the last subscriber releases an event, its
+	 * memory goes back to a lock-free free list of its size, so a steady
+	 * flow of input reuses the same chunks without calling the system
+	 * allocator. Input threads may allocate while the frame loop releases.
+	 * Sizes above MaxPooledSize use the global allocator.
+	 * @see makeEvent
+	 */
+	class EventPool
+	{
+		public:
+		/**
+		 * @brief Size granularity and alignment of pooled chunks.
+		 */
+		constexpr static std::size_t Granularity =
+			alignof(std::max_align_t);
+
+		/**
+		 * @brief Largest chunk size served by the pool.
+		 */
+		constexpr static std::size_t MaxPooledSize = 1024;
+
+		/**
+		 * @brief Number of free chunks kept per size; chunks released beyond
+		 * it go back to the global allocator.
+		 */
+		constexpr static std::size_t FreeChunksPerSize = 256;
+
+		private:
+		using FreeChunks = EventRing<void *>;	 ///< Free chunks of a size
+
+		std::array<std::atomic<FreeChunks *>, MaxPooledSize / Granularity>
+			_freeChunks {};	   ///< Free chunks, by size in granules minus
+							   ///< one, created on first use
+		std::atomic<std::size_t> _chunkCount {
+			0
+		};	  ///< Pooled-size chunks currently obtained from the allocator
+
+		/**
+		 * @brief Get the free chunks of a size, creating them if needed.
+		 * @param size The chunk size, at most MaxPooledSize.
+		 * @return The free chunks of the size.
+		 */
+		FreeChunks &getFreeChunks(std::size_t size);
+
+		public:
+		/**
+		 * @brief Default constructor.
+		 */
+		EventPool(void) = default;
+
+		/**
+		 * @brief Release the free chunks.
+		 */
+		~EventPool(void);
+
+		/**
+		 * @brief Get the pool shared by all events.
+		 * @return Reference to the pool, never destroyed.
+		 */
+		static EventPool &getInstance(void);
+
+		/**
+		 * @brief Allocate a chunk.
+		 * @param size The chunk size.
+		 * @return Pointer to memory aligned on Granularity.
+		 * @throws std::bad_alloc If memory is exhausted.
+		 */
+		void *allocate(std::size_t size);
+
+		/**
+		 * @brief Release a chunk returned by allocate().
+		 * @param pointer The chunk to release.
+		 * @param size The size passed to allocate().
+		 */
+		void deallocate(void *pointer, std::size_t size);
+
+		/**
+		 * @brief Get the number of pooled-size chunks obtained from the
+		 * global allocator and not returned to it.
+		 * @return The chunk count, stable once input reaches a steady state.
+		 */
+		std::size_t getChunkCount(void) const;
+	};
+
+	/**
+	 * @brief Standard allocator drawing from the EventPool.
+	 * @tparam Type The allocated type.
+	 */
+	template<typename Type> class EventAllocator
+	{
+		public:
+		using value_type = Type;	///< Allocated type
+
+		static_assert(alignof(Type) <= EventPool::Granularity,
+					  "Over-aligned events cannot be pooled");
+
+		/**
+		 * @brief Default constructor.
+		 */
+		EventAllocator(void) = default;
+
+		/**
+		 * @brief Converting constructor, used when rebinding.
+		 */
+		template<typename Other>
+		EventAllocator(const EventAllocator<Other> &) noexcept
+		{
+		}
+
+		/**
+		 * @brief Allocate memory for objects.
+		 * @param count The number of objects.
+		 * @return Pointer to the memory.
+		 */
+		Type *allocate(std::size_t count)
+		{
+			return static_cast<Type *>(
+				EventPool::getInstance().allocate(count * sizeof(Type)));
+		}
+
+		/**
+		 * @brief Release memory returned by allocate().
+		 * @param pointer The memory.
+		 * @param count The number of objects passed to allocate().
+		 */
+		void deallocate(Type *pointer, std::size_t count)
+		{
+			EventPool::getInstance().deallocate(pointer,
+												count * sizeof(Type));
+		}
+
+		template<typename Other>
+		bool operator==(const EventAllocator<Other> &) const noexcept
+		{
+			return true;
+		}
+	};
+
+	/**
+	 * @brief Create an event whose memory comes from the EventPool.
+	 *
+	 * The event and its reference counts share one pooled chunk, returned to
+	 * the pool when the last holder releases the event.
+	 * @tparam EventType The event type.
+	 * @param args Arguments forwarded to the event constructor.
+	 * @return The new event.
+	 */
+	template<utility::event::InheritFromEvent EventType, typename... Args>
+	std::shared_ptr<EventType> makeEvent(Args &&...args)
+	{
+		return std::allocate_shared<EventType>(EventAllocator<EventType>(),
+											   std::forward<Args>(args)...);
+	}
+
+}	 // namespace guillaume::event
\ No newline at end of file
@@ -0,0 +1,246 @@
+/*
+ Copyright (c) 2026 ETIB Corporation
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy of
+ this software and associated documentation files (the "Software"), to deal in
+ the Software without restriction, including without limitation the rights to
+ use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ of the Software, and to permit persons to whom the Software is furnished to do
+ so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in all
+ copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ SOFTWARE.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <memory>
+#include <utility>
+
+namespace guillaume::event
+{
+
+	/**
+	 * @brief What a full EventRing does with a new event.
+	 */
+	enum class OverflowPolicy {
+		DropNewest,	   ///< Discard the new event
+		DropOldest,	   ///< Discard the oldest pending event
+		Coalesce	   ///< Discard every pending event, keeping the new one
+	};
+
+	/**
+	 * @brief Bounded lock-free ring buffer carrying events from any number
+	 * of producer threads to a consumer.
+	 *
+	 * Each cell holds a sequence number telling producers and consumers
+	 * whose turn it is, so pushing and popping only take a compare-exchange
+	 * on a shared position. When the ring is full, the overflow policy
+	 * decides which event is lost. Dropping pending events makes the
+	 * producer pop them, which the ring supports alongside the consumer.
+	 * @tparam Value The stored type, default constructible and movable; a
+	 * moved-from value should hold no resource.
+	 */
+	template<typename Value> class EventRing
+	{
+		public:
+		/**
+		 * @brief Capacity used when none is given.
+		 */
+		constexpr static std::size_t DefaultCapacity = 256;
+
+		private:
+		/**
+		 * @brief Slot of the ring.
+		 */
+		struct Cell {
+			std::atomic<std::size_t> sequence { 0 };	///< Turn of the cell
+			Value value {};								///< Stored value
+		};
+
+		/**
+		 * @brief Size of a cache line, to keep positions apart.
+		 */
+		constexpr static std::size_t CacheLineSize = 64;
+
+		std::size_t _mask;				   ///< Cell count minus one
+		OverflowPolicy _overflowPolicy;	   ///< Behavior when full
+		std::unique_ptr<Cell[]> _cells;	   ///< Cells, a power of two
+		alignas(CacheLineSize) std::atomic<std::size_t> _pushPosition {
+			0
+		};	  ///< Next position to push to
+		alignas(CacheLineSize) std::atomic<std::size_t> _popPosition {
+			0
+		};	  ///< Next position to pop from
+		std::atomic<std::size_t> _droppedCount {
+			0
+		};	  ///< Events lost to overflow
+
+		public:
+		/**
+		 * @brief Construct an empty ring.
+		 * @param capacity Minimum number of events held, rounded up to a
+		 * power of two of at least 2.
+		 * @param overflowPolicy Behavior when the ring is full.
+		 */
+		explicit EventRing(
+			std::size_t capacity		  = DefaultCapacity,
+			OverflowPolicy overflowPolicy = OverflowPolicy::DropOldest)
+			: _mask(std::bit_ceil(std::max<std::size_t>(capacity, 2)) - 1)
+			, _overflowPolicy(overflowPolicy)
+		{
+			_cells = std::make_unique<Cell[]>(_mask + 1);
+			for (std::size_t index = 0; index <= _mask; ++index) {
+				_cells[index].sequence.store(index, std::memory_order_relaxed);
+			}
+		}
+
+		EventRing(const EventRing &)			= delete;
+		EventRing &operator=(const EventRing &) = delete;
+
+		/**
+		 * @brief Push a value if the ring is not full.
+		 * @param value The value, moved from only on success.
+		 * @return True if the value was pushed.
+		 */
+		bool tryPush(Value &&value)
+		{
+			std::size_t position =
+				_pushPosition.load(std::memory_order_relaxed);
+			Cell *cell = nullptr;
+			for (;;) {
+				cell = &_cells[position & _mask];
+				const std::size_t sequence =
+					cell->sequence.load(std::memory_order_acquire);
+				const auto turn = static_cast<std::ptrdiff_t>(sequence)
+					- static_cast<std::ptrdiff_t>(position);
+				if (turn == 0) {
+					if (_pushPosition.compare_exchange_weak(
+							position, position + 1,
+							std::memory_order_relaxed)) {
+						break;
+					}
+				} else if (turn < 0) {
+					return false;
+				} else {
+					position = _pushPosition.load(std::memory_order_relaxed);
+				}
+			}
+			cell->value = std::move(value);
+			cell->sequence.store(position + 1, std::memory_order_release);
+			return true;
+		}
+
+		/**
+		 * @brief Pop the oldest value.
+		 * @param value Receives the value.
+		 * @return True if a value was popped, false if the ring was empty.
+		 */
+		bool tryPop(Value &value)
+		{
+			std::size_t position =
+				_popPosition.load(std::memory_order_relaxed);
+			Cell *cell = nullptr;
+			for (;;) {
+				cell = &_cells[position & _mask];
+				const std::size_t sequence =
+					cell->sequence.load(std::memory_order_acquire);
+				const auto turn = static_cast<std::ptrdiff_t>(sequence)
+					- static_cast<std::ptrdiff_t>(position + 1);
+				if (turn == 0) {
+					if (_popPosition.compare_exchange_weak(
+							position, position + 1,
+							std::memory_order_relaxed)) {
+						break;
+					}
+				} else if (turn < 0) {
+					return false;
+				} else {
+					position = _popPosition.load(std::memory_order_relaxed);
+				}
+			}
+			value = std::move(cell->value);
+			cell->sequence.store(position + _mask + 1,
+								 std::memory_order_release);
+			return true;
+		}
+
+		/**
+		 * @brief Push a value, applying the overflow policy if the ring is
+		 * full.
+		 * @param value The value to push.
+		 * @return False if the value itself was dropped.
+		 */
+		bool push(Value &&value)
+		{
+			while (!tryPush(std::move(value))) {
+				if (_overflowPolicy == OverflowPolicy::DropNewest) {
+					_droppedCount.fetch_add(1, std::memory_order_relaxed);
+					return false;
+				}
+				Value dropped;
+				while (tryPop(dropped)) {
+					_droppedCount.fetch_add(1, std::memory_order_relaxed);
+					if (_overflowPolicy == OverflowPolicy::DropOldest) {
+						break;
+					}
+				}
+			}
+			return true;
+		}
+
+		/**
+		 * @brief Check whether the ring looks empty.
+		 * @return True if no value was pending at the time of the call.
+		 * @note Concurrent producers may push right after.
+		 */
+		bool empty(void) const
+		{
+			const std::size_t position =
+				_popPosition.load(std::memory_order_relaxed);
+			return _cells[position & _mask].sequence.load(
+					   std::memory_order_acquire)
+				!= position + 1;
+		}
+
+		/**
+		 * @brief Get the number of values the ring holds.
+		 * @return The capacity.
+		 */
+		std::size_t getCapacity(void) const
+		{
+			return _mask + 1;
+		}
+
+		/**
+		 * @brief Get the overflow policy.
+		 * @return The overflow policy.
+		 */
+		OverflowPolicy getOverflowPolicy(void) const
+		{
+			return _overflowPolicy;
+		}
+
+		/**
+		 * @brief Get the number of values lost to overflow.
+		 * @return The dropped value count.
+		 */
+		std::size_t getDroppedCount(void) const
+		{
+			return _droppedCount.load(std::memory_order_relaxed);
+		}
+	};
+
+}	 // namespace guillaume::event
\ No newline at end of file
@@ -22,10 +22,11 @@
 
 #pragma once
 
+#include <cstddef>
 #include <memory>
-#include <queue>
 
 #include "guillaume/event/event_bus.hpp"
+#include "guillaume/event/event_ring.hpp"
 #include <utility/event/event.hpp>
 
 namespace guillaume::event
@@ -36,34 +37,59 @@ namespace guillaume::event
 	 * @tparam EventType The type of event to subscribe to.
 	 *
 	 * This class provides a base for subscribing to specific event types from
-	 * the event bus. It maintains a queue of received events for processing.
+	 * the event bus. It maintains a queue of received events for processing;
+	 * the events are shared with the other subscribers and read-only.
+	 *
+	 * The queue is a bounded lock-free ring, so events may be published from
+	 * input threads while the frame loop consumes them. When it is full, the
+	 * overflow policy decides which event is lost.
+	 *
+	 * The subscriber unsubscribes on destruction, so it must not outlive its
+	 * event bus.
 	 * @see EventBus
 	 */
 	template<utility::event::InheritFromEvent EventType> class EventSubscriber
 	{
 		private:
-		std::queue<std::unique_ptr<EventType>>
-			_eventQueue;	///< Queue of received events
+		EventRing<std::shared_ptr<const EventType>>
+			_eventQueue;		  ///< Queue of received events
+		EventBus &_eventBus;	  ///< Event bus subscribed to
+		EventBus::SubscriptionId
+			_subscription;	  ///< Subscription of the queue to the bus
 
 		public:
 		/**
 		 * @brief Construct an event subscriber and register it to the event
 		 * bus.
 		 * @param eventBus The event bus to subscribe to.
+		 * @param capacity Minimum number of pending events kept.
+		 * @param overflowPolicy Behavior when the queue is full.
 		 */
-		EventSubscriber(EventBus &eventBus)
+		EventSubscriber(
+			EventBus &eventBus,
+			std::size_t capacity = EventRing<
+				std::shared_ptr<const EventType>>::DefaultCapacity,
+			OverflowPolicy overflowPolicy = OverflowPolicy::DropOldest)
+			: _eventQueue(capacity, overflowPolicy)
+			, _eventBus(eventBus)
+			, _subscription(eventBus.subscribe<EventType>(
+				  [this](const EventBus::EventPointer &event) {
+					  this->_eventQueue.push(
+						  std::static_pointer_cast<const EventType>(event));
+				  }))
 		{
-			eventBus.subscribe<EventType>(
-				[this](std::unique_ptr<utility::event::Event> event) {
-					this->_eventQueue.push(std::unique_ptr<EventType>(
-						static_cast<EventType *>(event.release())));
-				});
 		}
 
 		/**
-		 * @brief Destructor for the EventSubscriber base class.
+		 * @brief Unsubscribe from the event bus.
 		 */
-		~EventSubscriber(void) = default;
+		~EventSubscriber(void)
+		{
+			_eventBus.unsubscribe(_subscription);
+		}
+
+		EventSubscriber(const EventSubscriber &)			= delete;
+		EventSubscriber &operator=(const EventSubscriber &) = delete;
 
 		/**
 		 * @brief Check if there are pending events.
@@ -79,23 +105,30 @@ namespace guillaume::event
 		 * @return The next event.
 		 * @retval nullptr If the queue is empty.
 		 */
-		std::unique_ptr<EventType> getNextEvent(void)
+		std::shared_ptr<const EventType> getNextEvent(void)
 		{
-			if (_eventQueue.empty()) {
-				return nullptr;
-			}
-			std::unique_ptr<EventType> event = std::move(_eventQueue.front());
-			_eventQueue.pop();
+			std::shared_ptr<const EventType> event;
+			_eventQueue.tryPop(event);
 			return event;
 		}
 
+		/**
+		 * @brief Get the number of events lost because the queue was full.
+		 * @return The dropped event count.
+		 */
+		std::size_t getDroppedEventCount(void) const
+		{
+			return _eventQueue.getDroppedCount();
+		}
+
 		/**
 		 * @brief Add an event to the queue.
 		 * @param event The event to add.
 		 */
 		template<typename U> void pushUnhandledEvent(U &&event)
 		{
-			_eventQueue.push(std::forward<U>(event));
+			_eventQueue.push(
+				std::shared_ptr<const EventType>(std::forward<U>(event)));
 		}
 	};
 
@@ -0,0 +1,122 @@
+/*
+ Copyright (c) 2026 ETIB Corporation
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy of
+ this software and associated documentation files (the "Software"), to deal in
+ the Software without restriction, including without limitation the rights to
+ use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ of the Software, and to permit persons to whom the Software is furnished to do
+ so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in all
+ copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ SOFTWARE.
+ */
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <exception>
+#include <limits>
+#include <string>
+#include <typeinfo>
+
+#include <utility/event/event.hpp>
+
+#ifndef GUILLAUME_MAX_EVENT_TYPES
+	#define GUILLAUME_MAX_EVENT_TYPES 64
+#endif
+
+namespace guillaume::event
+{
+
+	/**
+	 * @brief Maximum number of distinct event types routed by the EventBus.
+	 *
+	 * Configured with the GUILLAUME_MAX_EVENT_TYPES CMake cache variable.
+	 */
+	constexpr std::size_t MaxEventTypes = GUILLAUME_MAX_EVENT_TYPES;
+
+	/**
+	 * @brief Exception thrown when the event type limit is exceeded.
+	 */
+	class EventTypeLimitExceededException: public std::exception
+	{
+		private:
+		std::string _message;
+
+		public:
+		/**
+		 * @brief Construct a new Event Type Limit Exceeded Exception.
+		 */
+		EventTypeLimitExceededException(void);
+
+		/**
+		 * @brief Get the exception message.
+		 * @return The exception message.
+		 */
+		const char *what(void) const noexcept override;
+	};
+
+	/**
+	 * @brief Event type id generator.
+	 *
+	 * Each event type gets a dense id on first use, indexing the routes of
+	 * the EventBus. Registration is lock-free. Ids follow first-use order
+	 * and must not be persisted.
+	 * @see MaxEventTypes
+	 * @see EventTypeLimitExceededException
+	 */
+	class EventTypeId
+	{
+		public:
+		/**
+		 * @brief Id value for unknown types.
+		 */
+		constexpr static std::size_t InvalidId =
+			std::numeric_limits<std::size_t>::max();
+
+		/**
+		 * @brief Get the id of an event type.
+		 * @tparam EventType The event type.
+		 * @return An id within [0, MaxEventTypes) for this process.
+		 * @throws EventTypeLimitExceededException If the maximum number of
+		 * event types has been exceeded.
+		 */
+		template<utility::event::InheritFromEvent EventType>
+		static std::size_t get(void)
+		{
+			static const std::size_t id = registerType(typeid(EventType));
+			return id;
+		}
+
+		/**
+		 * @brief Find the id of the dynamic type of an event.
+		 *
+		 * The first lookup of a type on a thread compares type_info
+		 * addresses, then names. Its result, found or not, is cached per
+		 * thread and type_info address, so later lookups are one hash map
+		 * access. Cached misses are dropped when a new type is registered.
+		 * @param type The type of the event.
+		 * @return The id, or InvalidId if get() was never called for the type.
+		 */
+		static std::size_t find(const std::type_info &type);
+
+		private:
+		/**
+		 * @brief Hand out the next id.
+		 * @param type The registered type.
+		 * @return The id.
+		 */
+		static std::size_t registerType(const std::type_info &type);
+	};
+
+}	 // namespace guillaume::event
\ No newline at end of file
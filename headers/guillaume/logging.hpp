@@ -0,0 +1,146 @@
+/*
+ Copyright (c) 2026 ETIB Corporation
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy of
+ this software and associated documentation files (the "Software"), to deal in
+ the Software without restriction, including without limitation the rights to
+ use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ of the Software, and to permit persons to whom the Software is furnished to do
+ so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in all
+ copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ SOFTWARE.
+ */
+
+#pragma once
+
+#include <utility>
+
+#ifndef GUILLAUME_MIN_LOG_LEVEL
+	#define GUILLAUME_MIN_LOG_LEVEL 0
+#endif
+
+namespace guillaume::logging
+{
+
+	/**
+	 * @brief Severity of a log message.
+	 */
+	enum class Level {
+		Debug,		  ///< Detailed tracing, typically per entity or per frame
+		Info,		  ///< Notable lifecycle events
+		Warning,	  ///< Recoverable problems
+		Error,		  ///< Failures
+		Disabled	  ///< No message at all
+	};
+
+	/**
+	 * @brief Lowest level compiled in.
+	 *
+	 * Configured with the GUILLAUME_MIN_LOG_LEVEL CMake cache variable.
+	 * Messages below it are discarded at compile time, formatting included.
+	 */
+	constexpr Level MinimumLevel = static_cast<Level>(GUILLAUME_MIN_LOG_LEVEL);
+
+	static_assert(MinimumLevel >= Level::Debug
+					  && MinimumLevel <= Level::Disabled,
+				  "GUILLAUME_MIN_LOG_LEVEL must be between 0 and 4");
+
+	/**
+	 * @brief Set the lowest level emitted at runtime.
+	 * @param level The new runtime level.
+	 * @note Levels below MinimumLevel stay discarded.
+	 */
+	void setLevel(Level level);
+
+	/**
+	 * @brief Get the lowest level emitted at runtime.
+	 * @return The runtime level, Info by default.
+	 */
+	Level getLevel(void);
+
+	/**
+	 * @brief Check whether messages of a level are emitted.
+	 * @tparam MessageLevel The message level.
+	 * @return True if the level is compiled in and enabled at runtime.
+	 */
+	template<Level MessageLevel> bool isEnabled(void)
+	{
+		if constexpr (MessageLevel < MinimumLevel) {
+			return false;
+		} else {
+			return MessageLevel >= getLevel();
+		}
+	}
+
+	/**
+	 * @brief Emit a message formatted only if its level is enabled.
+	 *
+	 * @code
+	 * logging::write<logging::Level::Debug>(getLogger(), [&] {
+	 *     return "Updating entity " + std::to_string(entityIdentifier);
+	 * });
+	 * @endcode
+	 *
+	 * @tparam MessageLevel The message level; Disabled is not a valid level.
+	 * @tparam Logger The logger type, exposing debug(), info(), warning()
+	 * and error().
+	 * @tparam Formatter Callable returning the message.
+	 * @param logger The logger receiving the message.
+	 * @param formatter Builds the message; not called when the level is
+	 * disabled.
+	 */
+	template<Level MessageLevel, typename Logger, typename Formatter>
+	void write(Logger &logger, Formatter &&formatter)
+	{
+		static_assert(MessageLevel != Level::Disabled,
+					  "Disabled is not a message level");
+		if constexpr (MessageLevel >= MinimumLevel) {
+			if (!isEnabled<MessageLevel>()) {
+				return;
+			}
+			if constexpr (MessageLevel == Level::Debug) {
+				logger.debug(std::forward<Formatter>(formatter)());
+			} else if constexpr (MessageLevel == Level::Info) {
+				logger.info(std::forward<Formatter>(formatter)());
+			} else if constexpr (MessageLevel == Level::Warning) {
+				logger.warning(std::forward<Formatter>(formatter)());
+			} else {
+				logger.error(std::forward<Formatter>(formatter)());
+			}
+		}
+	}
+
+	/**
+	 * @brief Emit a debug message formatted only if debug is enabled.
+	 * @param logger The logger receiving the message.
+	 * @param formatter Callable returning the message.
+	 * @see write
+	 */
+	template<typename Logger, typename Formatter>
+	void debug(Logger &logger, Formatter &&formatter)
+	{
+		write<Level::Debug>(logger, std::forward<Formatter>(formatter));
+	}
+
+	/**
+	 * @brief Emit an info message formatted only if info is enabled.
+	 * @param logger The logger receiving the message.
+	 * @param formatter Callable returning the message.
+	 * @see write
+	 */
+	template<typename Logger, typename Formatter>
+	void info(Logger &logger, Formatter &&formatter)
+	{
+		write<Level::Info>(logger, std::forward<Formatter>(formatter));
+	}
+
+}	 // namespace guillaume::logging
\ No newline at end of file
@@ -0,0 +1,89 @@
+/*
+ Copyright (c) 2026 ETIB Corporation
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy of
+ this software and associated documentation files (the "Software"), to deal in
+ the Software without restriction, including without limitation the rights to
+ use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ of the Software, and to permit persons to whom the Software is furnished to do
+ so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in all
+ copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ SOFTWARE.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include <utility/graphic/vertex.hpp>
+
+namespace guillaume
+{
+
+	/**
+	 * @brief Frame-wide stream of indexed triangles waiting to be drawn.
+	 *
+	 * Systems append their geometry instead of drawing it, and the renderer
+	 * submits the whole stream at once. Appended geometry keeps its order,
+	 * so later shapes are still drawn over earlier ones. Buffers keep their
+	 * capacity when cleared, so a steady scene appends without allocating.
+	 * @see Renderer::flush
+	 */
+	class RenderCommandList
+	{
+		public:
+		using Index = std::uint32_t;	///< Index into the vertex stream
+
+		private:
+		std::vector<utility::graphic::VertexF>
+			_vertices;	  ///< Vertices of every appended shape
+		std::vector<Index>
+			_indices;	 ///< Three indices per triangle, in draw order
+
+		public:
+		/**
+		 * @brief Append a triangle fan as indexed triangles.
+		 * @param fan The fan vertices, the anchor first. Fans of fewer than
+		 * three vertices are ignored.
+		 */
+		void appendTriangleFan(
+			std::span<const utility::graphic::VertexF> fan);
+
+		/**
+		 * @brief Get the vertex stream.
+		 * @return The vertices of every appended shape.
+		 */
+		const std::vector<utility::graphic::VertexF> &
+			getVertices(void) const;
+
+		/**
+		 * @brief Get the index stream.
+		 * @return Three indices per triangle, in draw order.
+		 */
+		const std::vector<Index> &getIndices(void) const;
+
+		/**
+		 * @brief Check whether anything was appended since the last clear.
+		 * @return True if there is no triangle to draw.
+		 */
+		bool empty(void) const;
+
+		/**
+		 * @brief Remove every shape, keeping the buffers' capacity.
+		 */
+		void clear(void);
+	};
+
+}	 // namespace guillaume
\ No newline at end of file
@@ -22,8 +22,10 @@
 
 #pragma once
 
+#include <cstddef>
 #include <functional>
 #include <optional>
+#include <span>
 #include <string>
 #include <vector>
 
@@ -41,6 +43,8 @@
 
 #include <utility/math/vector.hpp>
 
+#include "guillaume/render_command_list.hpp"
+
 namespace guillaume
 {
 
@@ -59,10 +63,26 @@ namespace guillaume
 			utility::math::Vector2F;	///< 2D vector representing viewport
 										///< width and height in pixels.
 
+		/**
+		 * @brief Geometry submitted from the command list during a frame.
+		 */
+		struct FrameStatistics {
+			std::size_t drawCalls { 0 };	///< Backend draw calls made
+			std::size_t vertices { 0 };		///< Triangle vertices drawn
+		};
+
 		private:
 		utility::graphic::ViewF _view;	  ///< View state
 			utility::RessourceManager _ressourceManager;	 ///< Shared text/resource manager
 			utility::DefaultAssetManager _assetManager;	 ///< Shared asset manager
+		RenderCommandList
+			_commandList;	 ///< Geometry waiting for the next flush
+		FrameStatistics _frameStatistics;	 ///< Statistics of the current
+											 ///< frame
+		FrameStatistics
+			_lastFrameStatistics;	 ///< Statistics of the last ended frame
+		std::vector<utility::graphic::VertexF>
+			_fanVertices;	 ///< Fan rebuilt by the default drawTriangles()
 
 		public:
 		/**
@@ -106,6 +126,21 @@ namespace guillaume
 		virtual void drawVertices(
 			const std::vector<utility::graphic::VertexF> &vertices) = 0;
 
+		/**
+		 * @brief Draw indexed triangles, ideally in a single draw call.
+		 *
+		 * The default implementation rebuilds the triangle fans appended to
+		 * the command list and draws each one through a single
+		 * drawVertices() call, as shapes were drawn before the command list
+		 * existed. Backends should override it to draw everything at once.
+		 * @param vertices The vertex stream.
+		 * @param indices Three indices into the vertex stream per triangle,
+		 * in draw order.
+		 */
+		virtual void drawTriangles(
+			std::span<const utility::graphic::VertexF> vertices,
+			std::span<const RenderCommandList::Index> indices);
+
 		/**
 		 * @brief Measures the pixel dimensions of a given text string when
 		 * rendered with a specific font.
@@ -124,6 +159,39 @@ namespace guillaume
 		virtual void drawText(const utility::graphic::Text &text,
 							  const utility::graphic::PoseF &pose) = 0;
 
+		/**
+		 * @brief Get the command list systems append their geometry to.
+		 * @return The command list drawn at the next flush().
+		 */
+		RenderCommandList &getCommandList(void);
+
+		/**
+		 * @brief Draw the command list and clear it.
+		 *
+		 * Systems drawing immediately, such as text, flush first so that
+		 * their output covers the geometry appended before it.
+		 */
+		void flush(void);
+
+		/**
+		 * @brief Start a frame: reset the statistics and the command list.
+		 */
+		void beginFrame(void);
+
+		/**
+		 * @brief End a frame: flush the command list and keep its statistics.
+		 */
+		void endFrame(void);
+
+		/**
+		 * @brief Get the statistics of the last ended frame.
+		 *
+		 * A drawTriangles() override counts as one draw call per flush; the
+		 * default implementation counts one per drawVertices() call.
+		 * @return The draw calls and vertices submitted during that frame.
+		 */
+		const FrameStatistics &getFrameStatistics(void) const;
+
 		/**
 		 * @brief Set the full view model.
 		 * @param view The new view instance.
@@ -28,6 +28,7 @@
 #include <utility/logging/loggable.hpp>
 #include <utility/logging/standard_logger.hpp>
 
+#include "guillaume/ecs/command_buffer.hpp"
 #include "guillaume/ecs/component_registry.hpp"
 #include "guillaume/ecs/entity_registry.hpp"
 #include "guillaume/ecs/entity_builder_manager_filler.hpp"
@@ -59,6 +60,9 @@ namespace guillaume
 			_entityBuilderManager;	  ///< Manager for entity builders
 		std::unique_ptr<ecs::EntityDirectorManager>
 			_entityDirectorManager;	   ///< Manager for entity directors
+		ecs::CommandBuffer
+			_commandBuffer;	   ///< Structural changes deferred to the next
+							   ///< phase boundary
 
 		protected:
 		/**
@@ -98,6 +102,16 @@ namespace guillaume
 		 * @return Reference to the entity registry.
 		 */
 		ecs::EntityRegistry &getEntityRegistry(void);
+
+		/**
+		 * @brief Get the command buffer for this scene.
+		 *
+		 * Callbacks running inside systems, such as click handlers, must
+		 * record entity creations and destructions and component additions
+		 * and removals here instead of applying them directly.
+		 * @return Reference to the command buffer.
+		 */
+		ecs::CommandBuffer &getCommandBuffer(void);
 	};
 
 	/**
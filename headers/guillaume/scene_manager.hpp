@@ -33,6 +33,7 @@
 
 #include "guillaume/scene.hpp"
 
+#include "guillaume/ecs/command_buffer.hpp"
 #include "guillaume/ecs/component_registry.hpp"
 #include "guillaume/ecs/entity_registry.hpp"
 #include "guillaume/ecs/system_registry.hpp"
@@ -123,5 +124,11 @@ namespace guillaume
 		 * @return Reference to the active component registry.
 		 */
 		ecs::ComponentRegistry &getActiveComponentRegistry(void);
+
+		/**
+		 * @brief Get the active command buffer.
+		 * @return Reference to the active command buffer.
+		 */
+		ecs::CommandBuffer &getActiveCommandBuffer(void);
 	};
 } // namespace guillaume
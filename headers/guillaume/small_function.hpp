@@ -0,0 +1,312 @@
+/*
+ Copyright (c) 2026 ETIB Corporation
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy of
+ this software and associated documentation files (the "Software"), to deal in
+ the Software without restriction, including without limitation the rights to
+ use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ of the Software, and to permit persons to whom the Software is furnished to do
+ so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in all
+ copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ SOFTWARE.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace guillaume
+{
+
+	template<typename Signature, std::size_t Capacity = 2 * sizeof(void *)>
+	class SmallFunction;
+
+	/**
+	 * @brief Copyable type-erased callable stored in place when small.
+	 *
+	 * Works like std::function, but callables of up to Capacity bytes, such
+	 * as lambdas capturing `this` and one more pointer, live inside the
+	 * object instead of on the heap. Larger callables are allocated.
+	 * @tparam Result The return type.
+	 * @tparam Arguments The argument types.
+	 * @tparam Capacity Bytes available for an in-place callable.
+	 */
+	template<typename Result, typename... Arguments, std::size_t Capacity>
+	class SmallFunction<Result(Arguments...), Capacity>
+	{
+		static_assert(Capacity >= sizeof(void *),
+					  "SmallFunction must at least hold a pointer");
+
+		private:
+		/**
+		 * @brief Operations of the stored callable type.
+		 */
+		struct Operations {
+			Result (*invoke)(void *storage, Arguments &&...arguments);
+			void (*copy)(const void *source, void *destination);
+			void (*move)(void *source, void *destination);
+			void (*destroy)(void *storage);
+		};
+
+		/**
+		 * @brief Whether a callable type is stored in place.
+		 * @tparam Callable The callable type.
+		 */
+		template<typename Callable>
+		static constexpr bool IsInPlace = sizeof(Callable) <= Capacity
+			&& alignof(Callable) <= alignof(void *)
+			&& std::is_nothrow_move_constructible_v<Callable>;
+
+		/**
+		 * @brief Operations of a callable stored in place.
+		 * @tparam Callable The callable type.
+		 */
+		template<typename Callable>
+		struct InPlace {
+			static Callable *get(void *storage)
+			{
+				return std::launder(static_cast<Callable *>(storage));
+			}
+
+			static Result invoke(void *storage, Arguments &&...arguments)
+			{
+				return std::invoke(*get(storage),
+								   std::forward<Arguments>(arguments)...);
+			}
+
+			static void copy(const void *source, void *destination)
+			{
+				::new (destination)
+					Callable(*get(const_cast<void *>(source)));
+			}
+
+			static void move(void *source, void *destination)
+			{
+				::new (destination) Callable(std::move(*get(source)));
+				get(source)->~Callable();
+			}
+
+			static void destroy(void *storage)
+			{
+				get(storage)->~Callable();
+			}
+
+			static constexpr Operations operations { invoke, copy, move,
+													 destroy };
+		};
+
+		/**
+		 * @brief Operations of a callable allocated on the heap, the storage
+		 * holding its address.
+		 * @tparam Callable The callable type.
+		 */
+		template<typename Callable>
+		struct OnHeap {
+			static Callable *&get(void *storage)
+			{
+				return *std::launder(static_cast<Callable **>(storage));
+			}
+
+			static Result invoke(void *storage, Arguments &&...arguments)
+			{
+				return std::invoke(*get(storage),
+								   std::forward<Arguments>(arguments)...);
+			}
+
+			static void copy(const void *source, void *destination)
+			{
+				::new (destination)
+					Callable *(new Callable(*get(const_cast<void *>(source))));
+			}
+
+			static void move(void *source, void *destination)
+			{
+				::new (destination) Callable *(get(source));
+			}
+
+			static void destroy(void *storage)
+			{
+				delete get(storage);
+			}
+
+			static constexpr Operations operations { invoke, copy, move,
+													 destroy };
+		};
+
+		alignas(void *) mutable unsigned char _storage
+			[Capacity];	   ///< In-place callable or heap address
+		const Operations *_operations {
+			nullptr
+		};	  ///< Operations of the stored callable, null when empty
+
+		/**
+		 * @brief Destroy the stored callable, if any.
+		 */
+		void reset(void)
+		{
+			if (_operations != nullptr) {
+				_operations->destroy(_storage);
+				_operations = nullptr;
+			}
+		}
+
+		public:
+		/**
+		 * @brief Construct an empty function.
+		 */
+		SmallFunction(void) = default;
+
+		/**
+		 * @brief Construct an empty function.
+		 */
+		SmallFunction(std::nullptr_t)
+		{
+		}
+
+		/**
+		 * @brief Store a callable.
+		 * @tparam Callable The callable type.
+		 * @param callable The callable, empty if it is a null pointer or an
+		 * empty std::function.
+		 */
+		template<typename Callable,
+				 typename Stored = std::decay_t<Callable>,
+				 typename = std::enable_if_t<
+					 !std::is_same_v<Stored, SmallFunction>
+					 && std::is_invocable_r_v<Result, Stored &, Arguments...>>>
+		SmallFunction(Callable &&callable)
+		{
+			if constexpr (std::is_pointer_v<Stored>
+						  || std::is_member_pointer_v<Stored>
+						  || std::is_constructible_v<bool, const Stored &>) {
+				if (!callable) {
+					return;
+				}
+			}
+			if constexpr (IsInPlace<Stored>) {
+				::new (static_cast<void *>(_storage))
+					Stored(std::forward<Callable>(callable));
+				_operations = &InPlace<Stored>::operations;
+			} else {
+				::new (static_cast<void *>(_storage))
+					Stored *(new Stored(std::forward<Callable>(callable)));
+				_operations = &OnHeap<Stored>::operations;
+			}
+		}
+
+		/**
+		 * @brief Copy the callable of another function.
+		 * @param other The function to copy.
+		 */
+		SmallFunction(const SmallFunction &other)
+		{
+			if (other._operations != nullptr) {
+				other._operations->copy(other._storage, _storage);
+				_operations = other._operations;
+			}
+		}
+
+		/**
+		 * @brief Take the callable of another function, leaving it empty.
+		 * @param other The function to move from.
+		 */
+		SmallFunction(SmallFunction &&other) noexcept
+		{
+			if (other._operations != nullptr) {
+				other._operations->move(other._storage, _storage);
+				_operations		  = other._operations;
+				other._operations = nullptr;
+			}
+		}
+
+		/**
+		 * @brief Destroy the stored callable.
+		 */
+		~SmallFunction(void)
+		{
+			reset();
+		}
+
+		/**
+		 * @brief Replace the callable with a copy of another function's.
+		 * @param other The function to copy.
+		 * @return Reference to this function.
+		 */
+		SmallFunction &operator=(const SmallFunction &other)
+		{
+			if (this != &other) {
+				SmallFunction copy(other);
+				*this = std::move(copy);
+			}
+			return *this;
+		}
+
+		/**
+		 * @brief Replace the callable with another function's, leaving it
+		 * empty.
+		 * @param other The function to move from.
+		 * @return Reference to this function.
+		 */
+		SmallFunction &operator=(SmallFunction &&other) noexcept
+		{
+			if (this != &other) {
+				reset();
+				if (other._operations != nullptr) {
+					other._operations->move(other._storage, _storage);
+					_operations		  = other._operations;
+					other._operations = nullptr;
+				}
+			}
+			return *this;
+		}
+
+		/**
+		 * @brief Empty the function.
+		 * @return Reference to this function.
+		 */
+		SmallFunction &operator=(std::nullptr_t)
+		{
+			reset();
+			return *this;
+		}
+
+		/**
+		 * @brief Check whether a callable is stored.
+		 * @return True if the function is not empty.
+		 */
+		explicit operator bool(void) const
+		{
+			return _operations != nullptr;
+		}
+
+		/**
+		 * @brief Call the stored callable.
+		 * @param arguments The arguments to forward.
+		 * @return The callable's result.
+		 * @throw std::bad_function_call If the function is empty.
+		 */
+		Result operator()(Arguments... arguments) const
+		{
+			if (_operations == nullptr) {
+				throw std::bad_function_call();
+			}
+			return _operations->invoke(_storage,
+									   std::forward<Arguments>(arguments)...);
+		}
+	};
+
+}	 // namespace guillaume
\ No newline at end of file
@@ -0,0 +1,197 @@
+/*
+ Copyright (c) 2026 ETIB Corporation
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy of
+ this software and associated documentation files (the "Software"), to deal in
+ the Software without restriction, including without limitation the rights to
+ use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ of the Software, and to permit persons to whom the Software is furnished to do
+ so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in all
+ copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ SOFTWARE.
+ */
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <unordered_map>
+#include <vector>
+
+#include <utility/graphic/ray.hpp>
+
+#include "guillaume/ecs/entity.hpp"
+#include "guillaume/spatial/oriented_rectangle.hpp"
+#include "guillaume/spatial/ray_cast.hpp"
+
+namespace guillaume::spatial
+{
+
+	/**
+	 * @brief Bounding volume hierarchy over the world-space bounds of
+	 * rectangles, answering nearest-hit ray queries.
+	 *
+	 * Nodes are stored in one array, children next to each other. Moving a
+	 * rectangle refits the bounds of its leaf and ancestors on the next
+	 * query; adding or removing one rebuilds the tree with median splits.
+	 * Rays are traversed in packets of PacketSize lanes, so the box tests of
+	 * the rays of both hands share each node visit and vectorize.
+	 */
+	class BoundingVolumeHierarchy
+	{
+		public:
+		using Identifier = ecs::Entity::Identifier;	   ///< Rectangle owner
+
+		/**
+		 * @brief Largest number of rectangles in a leaf.
+		 */
+		constexpr static std::size_t MaxLeafSize = 4;
+
+		/**
+		 * @brief Number of rays traversed together.
+		 */
+		constexpr static std::size_t PacketSize = 4;
+
+		private:
+		/**
+		 * @brief Axis-aligned world-space bounds.
+		 */
+		struct Bounds3D {
+			std::array<float, 3> minimum;	 ///< Lowest x, y and z
+			std::array<float, 3> maximum;	 ///< Highest x, y and z
+		};
+
+		/**
+		 * @brief An indexed rectangle.
+		 */
+		struct Item {
+			Identifier identifier;			///< Owner of the rectangle
+			OrientedRectangle rectangle;	///< Indexed rectangle
+			Bounds3D bounds;				///< World-space bounds
+		};
+
+		/**
+		 * @brief A node; leaves list items, inner nodes two children.
+		 */
+		struct Node {
+			Bounds3D bounds;	///< Bounds of everything below
+			std::uint32_t first { 0 };	  ///< First entry of _order for a
+										  ///< leaf, else the left child
+			std::uint32_t count { 0 };	  ///< Items of a leaf, 0 for inner
+			std::uint32_t parent { 0 };	   ///< Parent node, itself for the
+										   ///< root
+		};
+
+		std::vector<Item> _items;	 ///< Indexed rectangles
+		std::unordered_map<Identifier, std::size_t>
+			_slots;	   ///< Index in _items of each owner
+		std::vector<Node> _nodes;	 ///< Tree nodes, root first
+		std::vector<std::uint32_t> _order;	  ///< Items grouped by leaf
+		std::vector<std::uint32_t> _leaves;	   ///< Leaf of each item
+		std::vector<std::uint32_t> _moved;	  ///< Items to refit
+		bool _needsRebuild { false };	 ///< Items were added or removed
+
+		/**
+		 * @brief Compute the world-space bounds of a rectangle.
+		 * @param rectangle The rectangle.
+		 * @return The bounds.
+		 */
+		static Bounds3D getBounds(const OrientedRectangle &rectangle);
+
+		/**
+		 * @brief Compute the bounds of a leaf or of the children of a node.
+		 * @param node The node.
+		 * @return The bounds.
+		 */
+		Bounds3D computeNodeBounds(const Node &node) const;
+
+		/**
+		 * @brief Build the subtree of a node over a range of _order.
+		 * @param nodeIndex The node to fill.
+		 * @param parent The parent of the node.
+		 * @param begin First entry of _order.
+		 * @param end Past the last entry of _order.
+		 */
+		void build(std::uint32_t nodeIndex, std::uint32_t parent,
+				   std::size_t begin, std::size_t end);
+
+		/**
+		 * @brief Rebuild the tree or refit moved items before a query.
+		 */
+		void refresh(void);
+
+		public:
+		/**
+		 * @brief Construct an empty hierarchy.
+		 */
+		BoundingVolumeHierarchy(void) = default;
+
+		/**
+		 * @brief Default destructor.
+		 */
+		~BoundingVolumeHierarchy(void) = default;
+
+		/**
+		 * @brief Index the rectangle of an owner, replacing its previous one.
+		 * @param identifier The owner.
+		 * @param rectangle The rectangle.
+		 */
+		void insert(const Identifier &identifier,
+					const OrientedRectangle &rectangle);
+
+		/**
+		 * @brief Remove the rectangle of an owner.
+		 * @param identifier The owner.
+		 * @return True if the owner was indexed, false otherwise.
+		 */
+		bool remove(const Identifier &identifier);
+
+		/**
+		 * @brief Remove every rectangle.
+		 */
+		void clear(void);
+
+		/**
+		 * @brief Check whether an owner is indexed.
+		 * @param identifier The owner.
+		 * @return True if the owner is indexed, false otherwise.
+		 */
+		bool contains(const Identifier &identifier) const;
+
+		/**
+		 * @brief Get the number of indexed rectangles.
+		 * @return The rectangle count.
+		 */
+		std::size_t size(void) const;
+
+		/**
+		 * @brief Find the nearest rectangle hit by each ray.
+		 * @param rays The rays, such as one per hand.
+		 * @param hits Receives the hit of each ray, or std::nullopt; must be
+		 * as long as rays.
+		 */
+		void intersectNearest(std::span<const utility::graphic::RayF> rays,
+							  std::span<std::optional<RayHit>> hits);
+
+		/**
+		 * @brief Find the nearest rectangle hit by a ray.
+		 * @param ray The ray.
+		 * @return The hit, or std::nullopt if the ray hits nothing.
+		 */
+		std::optional<RayHit>
+			intersectNearest(const utility::graphic::RayF &ray);
+	};
+
+}	 // namespace guillaume::spatial
\ No newline at end of file
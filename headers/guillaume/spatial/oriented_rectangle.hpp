@@ -0,0 +1,152 @@
+/*
+ Copyright (c) 2026 ETIB Corporation
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy of
+ this software and associated documentation files (the "Software"), to deal in
+ the Software without restriction, including without limitation the rights to
+ use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ of the Software, and to permit persons to whom the Software is furnished to do
+ so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in all
+ copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ SOFTWARE.
+ */
+
+#pragma once
+
+#include <utility/graphic/orientation.hpp>
+#include <utility/graphic/pose.hpp>
+#include <utility/graphic/position.hpp>
+#include <utility/graphic/ray.hpp>
+#include <utility/math/vector.hpp>
+
+namespace guillaume::spatial
+{
+
+	/**
+	 * @brief Axis-aligned bounds in the screen plane.
+	 */
+	struct Bounds2D {
+		utility::math::Vector2F minimum;	///< Lowest x and y
+		utility::math::Vector2F maximum;	///< Highest x and y
+	};
+
+	/**
+	 * @brief Rectangle placed in world space, as drawn for an entity.
+	 *
+	 * The rectangle spans two axes given by an orientation around its center.
+	 * It matches the geometry RectangleRender draws from a Transform and a
+	 * Bound, so hit tests agree with what is on screen.
+	 */
+	class OrientedRectangle
+	{
+		private:
+		utility::graphic::PositionF _center;	///< World-space center
+		utility::math::Vector3F _axisX;		///< Unit axis along the width
+		utility::math::Vector3F _axisY;		///< Unit axis along the height
+		utility::math::Vector3F _normal;	///< Unit normal, axisX x axisY
+		float _halfWidth { 0.0f };	   ///< Half of the width
+		float _halfHeight { 0.0f };	   ///< Half of the height
+
+		public:
+		/**
+		 * @brief Default constructor, an empty rectangle that contains no
+		 * point.
+		 */
+		OrientedRectangle(void) = default;
+
+		/**
+		 * @brief Construct a rectangle around a center.
+		 * @param center The world-space center.
+		 * @param orientation The orientation of the rectangle.
+		 * @param width The width, along the rotated x axis.
+		 * @param height The height, along the rotated y axis.
+		 */
+		OrientedRectangle(const utility::graphic::PositionF &center,
+						  const utility::graphic::OrientationF &orientation,
+						  float width, float height);
+
+		/**
+		 * @brief Build the rectangle drawn for an entity.
+		 * @param pose The entity pose; its position is the middle of the top
+		 * edge before rotation.
+		 * @param width The entity width.
+		 * @param height The entity height.
+		 * @return The rectangle.
+		 */
+		static OrientedRectangle fromPose(const utility::graphic::PoseF &pose,
+										  float width, float height);
+
+		/**
+		 * @brief Get the world-space center.
+		 * @return The center.
+		 */
+		const utility::graphic::PositionF &getCenter(void) const;
+
+		/**
+		 * @brief Get the unit axis along the width.
+		 * @return The axis.
+		 */
+		const utility::math::Vector3F &getAxisX(void) const;
+
+		/**
+		 * @brief Get the unit axis along the height.
+		 * @return The axis.
+		 */
+		const utility::math::Vector3F &getAxisY(void) const;
+
+		/**
+		 * @brief Get the unit normal of the rectangle's plane.
+		 * @return The normal.
+		 */
+		const utility::math::Vector3F &getNormal(void) const;
+
+		/**
+		 * @brief Get half of the width.
+		 * @return The half width.
+		 */
+		float getHalfWidth(void) const;
+
+		/**
+		 * @brief Get half of the height.
+		 * @return The half height.
+		 */
+		float getHalfHeight(void) const;
+
+		/**
+		 * @brief Get the bounds of the rectangle projected on the screen
+		 * plane, along the z axis.
+		 * @return The projected bounds.
+		 */
+		Bounds2D getProjectedBounds(void) const;
+
+		/**
+		 * @brief Check whether a screen-plane point falls on the projection
+		 * of the rectangle along the z axis.
+		 * @param point The point, in world x and y.
+		 * @return True if the point is inside, false otherwise or if the
+		 * rectangle is seen edge-on.
+		 */
+		bool containsProjected(const utility::math::Vector2F &point) const;
+
+		/**
+		 * @brief Intersect a ray with the rectangle, from either side.
+		 * @param ray The ray.
+		 * @param maximumDistance Hits farther along the ray are ignored.
+		 * @param distance Set to the distance of the hit, in lengths of the
+		 * ray direction.
+		 * @return True if the ray hits the rectangle within the distance.
+		 */
+		bool intersect(const utility::graphic::RayF &ray,
+					   float maximumDistance, float &distance) const;
+	};
+
+}	 // namespace guillaume::spatial
\ No newline at end of file
@@ -0,0 +1,61 @@
+/*
+ Copyright (c) 2026 ETIB Corporation
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy of
+ this software and associated documentation files (the "Software"), to deal in
+ the Software without restriction, including without limitation the rights to
+ use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ of the Software, and to permit persons to whom the Software is furnished to do
+ so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in all
+ copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ SOFTWARE.
+ */
+
+#pragma once
+
+#include <utility/graphic/orientation.hpp>
+#include <utility/graphic/pose.hpp>
+#include <utility/graphic/ray.hpp>
+#include <utility/math/vector.hpp>
+
+#include "guillaume/ecs/entity.hpp"
+
+namespace guillaume::spatial
+{
+
+	/**
+	 * @brief Nearest rectangle hit by a ray.
+	 */
+	struct RayHit {
+		ecs::Entity::Identifier identifier;	   ///< Owner of the rectangle
+		float distance;	   ///< Distance along the ray, in direction lengths
+	};
+
+	/**
+	 * @brief Rotate a vector by an orientation.
+	 * @param vector The vector to rotate.
+	 * @param orientation The orientation, normalized by the function.
+	 * @return The rotated vector.
+	 */
+	utility::math::Vector3F
+		rotate(const utility::math::Vector3F &vector,
+			   const utility::graphic::OrientationF &orientation);
+
+	/**
+	 * @brief Build the ray a pose points along.
+	 * @param pose The pose, such as the aim pose of a hand or controller.
+	 * @return The ray from the pose position along its local -z axis, the
+	 * forward direction of OpenXR poses.
+	 */
+	utility::graphic::RayF makeForwardRay(const utility::graphic::PoseF &pose);
+
+}	 // namespace guillaume::spatial
\ No newline at end of file
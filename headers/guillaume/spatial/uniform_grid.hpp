@@ -0,0 +1,187 @@
+/*
+ Copyright (c) 2026 ETIB Corporation
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy of
+ this software and associated documentation files (the "Software"), to deal in
+ the Software without restriction, including without limitation the rights to
+ use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ of the Software, and to permit persons to whom the Software is furnished to do
+ so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in all
+ copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ SOFTWARE.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+#include <utility/math/vector.hpp>
+
+#include "guillaume/ecs/entity.hpp"
+#include "guillaume/spatial/oriented_rectangle.hpp"
+
+namespace guillaume::spatial
+{
+
+	/**
+	 * @brief Uniform grid over the screen-plane bounds of rectangles.
+	 *
+	 * Each rectangle is listed in the cells its projected bounds overlap, so
+	 * a point query only tests the rectangles of one cell. Rectangles that
+	 * would span more than MaxCellsPerRectangle cells, such as backgrounds,
+	 * are kept in a separate list tested by every query. Moving a rectangle
+	 * only relinks the cells it leaves and enters.
+	 */
+	class UniformGrid
+	{
+		public:
+		using Identifier = ecs::Entity::Identifier;	   ///< Rectangle owner
+
+		/**
+		 * @brief Default width and height of a cell, in world units.
+		 */
+		constexpr static float DefaultCellSize = 128.0f;
+
+		/**
+		 * @brief Largest number of cells a rectangle is listed in.
+		 */
+		constexpr static std::size_t MaxCellsPerRectangle = 64;
+
+		private:
+		/**
+		 * @brief Inclusive range of cells.
+		 */
+		struct CellRange {
+			std::int32_t minimumX { 0 };	///< First column
+			std::int32_t minimumY { 0 };	///< First row
+			std::int32_t maximumX { -1 };	 ///< Last column
+			std::int32_t maximumY { -1 };	 ///< Last row
+
+			bool operator==(const CellRange &) const = default;
+		};
+
+		/**
+		 * @brief A rectangle and the cells it is listed in.
+		 */
+		struct Entry {
+			OrientedRectangle rectangle;	///< Indexed rectangle
+			CellRange cells;				///< Cells listing the rectangle
+			bool isOversized { false };	   ///< Listed in _oversized instead
+		};
+
+		float _cellSize;	///< Width and height of a cell
+		std::unordered_map<Identifier, Entry>
+			_entries;	 ///< Indexed rectangles by owner
+		std::unordered_map<std::uint64_t, std::vector<Identifier>>
+			_cells;	   ///< Owners listed in each non-empty cell
+		std::vector<Identifier> _oversized;	   ///< Owners tested by every
+											   ///< query
+
+		/**
+		 * @brief Get the cell containing a coordinate.
+		 * @param coordinate The x or y coordinate.
+		 * @return The column or row.
+		 */
+		std::int32_t getCell(float coordinate) const;
+
+		/**
+		 * @brief Get the key of a cell.
+		 * @param column The column.
+		 * @param row The row.
+		 * @return A key unique to the cell.
+		 */
+		static std::uint64_t getCellKey(std::int32_t column,
+										std::int32_t row);
+
+		/**
+		 * @brief Get the cells overlapped by a rectangle.
+		 * @param rectangle The rectangle.
+		 * @param isOversized Set to true if the rectangle spans too many
+		 * cells, or has non-finite bounds, to be listed in them.
+		 * @return The cells.
+		 */
+		CellRange getCells(const OrientedRectangle &rectangle,
+						   bool &isOversized) const;
+
+		/**
+		 * @brief List an owner in its cells.
+		 * @param identifier The owner.
+		 * @param entry The entry of the owner.
+		 */
+		void link(const Identifier &identifier, const Entry &entry);
+
+		/**
+		 * @brief Remove an owner from its cells.
+		 * @param identifier The owner.
+		 * @param entry The entry of the owner.
+		 */
+		void unlink(const Identifier &identifier, const Entry &entry);
+
+		public:
+		/**
+		 * @brief Construct an empty grid.
+		 * @param cellSize Width and height of a cell; a few times the size of
+		 * a typical widget works best.
+		 */
+		explicit UniformGrid(float cellSize = DefaultCellSize);
+
+		/**
+		 * @brief Default destructor.
+		 */
+		~UniformGrid(void) = default;
+
+		/**
+		 * @brief Index the rectangle of an owner, replacing its previous one.
+		 * @param identifier The owner.
+		 * @param rectangle The rectangle.
+		 */
+		void insert(const Identifier &identifier,
+					const OrientedRectangle &rectangle);
+
+		/**
+		 * @brief Remove the rectangle of an owner.
+		 * @param identifier The owner.
+		 * @return True if the owner was indexed, false otherwise.
+		 */
+		bool remove(const Identifier &identifier);
+
+		/**
+		 * @brief Remove every rectangle.
+		 */
+		void clear(void);
+
+		/**
+		 * @brief Check whether an owner is indexed.
+		 * @param identifier The owner.
+		 * @return True if the owner is indexed, false otherwise.
+		 */
+		bool contains(const Identifier &identifier) const;
+
+		/**
+		 * @brief Get the number of indexed rectangles.
+		 * @return The rectangle count.
+		 */
+		std::size_t size(void) const;
+
+		/**
+		 * @brief Find the rectangles whose projection contains a point.
+		 * @param point The point, in world x and y.
+		 * @param hits Replaced by the owners found, sorted by identifier.
+		 */
+		void queryPoint(const utility::math::Vector2F &point,
+						std::vector<Identifier> &hits) const;
+	};
+
+}	 // namespace guillaume::spatial
\ No newline at end of file
@@ -42,8 +42,9 @@ namespace guillaume::systems
 	 * @see components::Transform
 	 */
 	class GlyphRender:
-		public ecs::SystemFiller<components::Transform, components::Bound,
-								 components::Glyph, components::Color>
+		public ecs::SystemFiller<
+			ecs::Reads<components::Transform, components::Bound,
+					   components::Glyph, components::Color>>
 	{
 		private:
 		Renderer &_renderer;			 ///< Renderer instance
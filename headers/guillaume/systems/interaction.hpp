@@ -30,6 +30,13 @@
 
 #include "guillaume/event/event_subscriber.hpp"
 #include "guillaume/renderer.hpp"
+#include "guillaume/spatial/bounding_volume_hierarchy.hpp"
+#include "guillaume/spatial/uniform_grid.hpp"
+
+#include <cstddef>
+#include <optional>
+#include <span>
+#include <vector>
 
 #include <utility/event/hand_button_event.hpp>
 #include <utility/event/hand_motion_event.hpp>
@@ -44,54 +51,155 @@ namespace guillaume::systems
 
 	/**
 	 * @brief System handling pointer interactions (hover and click).
+	 *
+	 * Interactive entities are indexed in a uniform grid of their on-screen
+	 * rectangles, kept up to date from the change logs of their Transform,
+	 * Bound and Interaction components. The pointer is resolved against the
+	 * grid once per frame instead of being tested against every entity.
+	 * Hand rays are cast once per frame into a bounding volume hierarchy of
+	 * the same rectangles in world space; only the nearest entity hit is
+	 * hovered, pinched or poked.
+	 *
+	 * Entities are not polled: each frame, only the entities under a pointer
+	 * and those left hovered, pressed, pinched or poked by a previous frame
+	 * are updated, so idle interactive entities cost nothing.
+	 *
+	 * Handlers run while the system iterates the scene: they must record
+	 * structural changes in the scene's ecs::CommandBuffer rather than
+	 * applying them directly.
 	 * @see components::Interaction
+	 * @see Scene::getCommandBuffer
 	 */
 	class Interaction:
-		public ecs::SystemFiller<components::Interaction, components::Transform,
-								 components::Bound>
+		public ecs::SystemFiller<
+			ecs::Writes<components::Interaction>,
+			ecs::Reads<components::Transform, components::Bound>>
 	{
 		private:
 		event::EventSubscriber<utility::event::MouseButtonEvent>
 			_mouseButtonSubscriber;	   ///< Subscriber for mouse button events
-		std::unique_ptr<utility::event::MouseButtonEvent>
+		std::shared_ptr<const utility::event::MouseButtonEvent>
 			_lastMouseButtonEvent;	  ///< Last received mouse button event for
 									  ///< click processing
 
 		event::EventSubscriber<utility::event::MouseMotionEvent>
 			_mouseMotionSubscriber;	   ///< Subscriber for mouse motion events
-		std::unique_ptr<utility::event::MouseMotionEvent>
+		std::shared_ptr<const utility::event::MouseMotionEvent>
 			_lastMouseMotionEvent;	  ///< Last received mouse motion event for
 									  ///< hover processing
 
 		event::EventSubscriber<utility::event::HandButtonEvent>
 			_handButtonSubscriber;	///< Subscriber for XR hand
 											///< button events
-		std::unique_ptr<utility::event::HandButtonEvent>
+		std::shared_ptr<const utility::event::HandButtonEvent>
 			_lastHandButtonEvent;	   ///< Last received hand button
 										   ///< event for click processing
 
 		event::EventSubscriber<utility::event::HandMotionEvent>
 			_handMotionSubscriber;	///< Subscriber for XR hand
 											///< motion events
-		std::unique_ptr<utility::event::HandMotionEvent>
+		std::shared_ptr<const utility::event::HandMotionEvent>
 			_lastHandMotionEvent;	   ///< Last received hand motion
 										   ///< event for hover processing
 
 		event::EventSubscriber<utility::event::HandPinchEvent>
 			_handPinchSubscriber;	 ///< Subscriber for XR hand pinch events
-		std::unique_ptr<utility::event::HandPinchEvent>
+		std::shared_ptr<const utility::event::HandPinchEvent>
 			_lastHandPinchEvent;	///< Last received hand pinch event for
 									///< click processing
 
 		event::EventSubscriber<utility::event::HandPokeEvent>
 			_handPokeSubscriber;	///< Subscriber for XR hand poke events
-		std::unique_ptr<utility::event::HandPokeEvent>
+		std::shared_ptr<const utility::event::HandPokeEvent>
 			_lastHandPokeEvent;	   ///< Last received hand poke event for click
 								   ///< processing
 
 		Renderer &_renderer;	///< Reference to the renderer for view and
 								///< viewport information
 
+		spatial::UniformGrid
+			_hitGrid;	 ///< On-screen rectangles of interactive entities
+		const ecs::ComponentRegistry *_indexedRegistry {
+			nullptr
+		};	  ///< Registry the grid was built from
+		ecs::ComponentRegistry::Frame _indexedFrame {
+			0
+		};	  ///< Frame of the last grid update
+		spatial::BoundingVolumeHierarchy
+			_rayIndex;	  ///< World-space rectangles of interactive entities
+		std::vector<ecs::Entity::Identifier>
+			_mouseHits;	   ///< Reused buffer of the entities under the mouse
+		std::optional<ecs::Entity::Identifier>
+			_mouseHit;	  ///< Topmost entity under the mouse
+		std::optional<spatial::RayHit>
+			_handHit;	 ///< Nearest entity hit by the hand ray
+		bool _hasNewHandPinch {
+			false
+		};	  ///< Whether a hand pinch event arrived this frame
+		bool _hasNewHandPoke {
+			false
+		};	  ///< Whether a hand poke event arrived this frame
+		std::vector<ecs::Entity::Identifier>
+			_engagedEntities;	 ///< Entities whose interaction state may
+								 ///< still change without a hit, sorted
+		std::vector<ecs::Entity::Identifier>
+			_dispatchTargets;	 ///< Entities updated this frame
+
+		/**
+		 * @brief Apply the pointer transitions to an entity.
+		 * @param entityIdentifier The identifier of the entity to update.
+		 * @return True if the entity is left in a state that a later frame
+		 * may change even when no pointer hits it.
+		 */
+		bool dispatch(const ecs::Entity::Identifier &entityIdentifier);
+
+		/**
+		 * @brief Check whether an entity still owns the components giving it
+		 * an interactive rectangle.
+		 * @param entityIdentifier The identifier of the entity.
+		 * @return True if the entity owns Interaction, Transform and Bound.
+		 */
+		bool isInteractive(const ecs::Entity::Identifier &entityIdentifier);
+
+		/**
+		 * @brief Index the rectangle of an entity, or remove it from the grid
+		 * if it lost one of its components.
+		 * @param entityIdentifier The identifier of the entity.
+		 */
+		void indexEntity(const ecs::Entity::Identifier &entityIdentifier);
+
+		/**
+		 * @brief Bring the grid up to date with the component registry.
+		 *
+		 * Entities whose components changed, were added or were removed
+		 * since the last update are reindexed, which drops the entities that
+		 * are no longer interactive. The grid is only rebuilt when the
+		 * registry changes or when the change history no longer reaches the
+		 * last update.
+		 */
+		void updateHitGrid(void);
+
+		/**
+		 * @brief Reindex the entities of change or removal log entries.
+		 * @param entries The log entries.
+		 */
+		void reindexEntries(std::span<const ecs::ChangeLog::Entry> entries);
+
+		/**
+		 * @brief Find the topmost entity under the last mouse position.
+		 *
+		 * Of the rectangles under the mouse, the entity listed last in the
+		 * query wins: entities are painted in query order, so it is the one
+		 * drawn on top.
+		 * @param query The query listing the interactive entities.
+		 */
+		void resolveMouseHit(const ecs::EntityQuery &query);
+
+		/**
+		 * @brief Find the nearest entity hit by the last hand aim ray.
+		 */
+		void resolveHandHit(void);
+
 		/**
 		 * @brief Update the last input events for click and hover processing.
 		 * This method should be called at the beginning of each update cycle
@@ -133,6 +241,7 @@ namespace guillaume::systems
 		 * based on the latest hand button events and whether the pointer
 		 * is inside the entity bounds.
 		 * @param entityIdentifier The identifier of the entity to update.
+		 * @param isInside Whether the hand ray hits the entity first.
 		 */
 		void processHandButtonClick(
 			const ecs::Entity::Identifier &entityIdentifier, bool isInside);
@@ -141,7 +250,11 @@ namespace guillaume::systems
 		 * @brief Update the state for the specified entity based on the
 		 * latest hand pinch events and whether the pointer is inside the entity
 		 * bounds.
+		 *
+		 * An entity is pinched during the frames a pinch event arrives while
+		 * the hand ray hits it first.
 		 * @param entityIdentifier The identifier of the entity to update.
+		 * @param isInside Whether the hand ray hits the entity first.
 		 */
 		void processHandPinch(const ecs::Entity::Identifier &entityIdentifier,
 							  bool isInside);
@@ -150,6 +263,9 @@ namespace guillaume::systems
 		 * @brief Update the hand poke state for the specified entity based on
 		 * the latest hand poke events and whether the pointer is inside the
 		 * entity bounds.
+		 *
+		 * An entity is poked during the frames a poke event arrives while
+		 * the hand ray hits it first.
 		 * @param entityIdentifier The identifier of the entity to update.
 		 * @param isInside Whether the pointer is currently inside the entity
 		 * bounds.
@@ -174,8 +290,21 @@ namespace guillaume::systems
 		/**
 		 * @brief Update the Interaction system for the specified entity.
 		 * @param entityIdentifier The identifier of the entity to update.
+		 * @note Uses the pointer hits resolved by the last updateQuery().
 		 */
 		void update(const ecs::Entity::Identifier &entityIdentifier) override;
+
+		/**
+		 * @brief Read the input events, resolve them against the hit grid
+		 * and update the entities they concern.
+		 *
+		 * Only the entities under a pointer and the engaged ones are updated;
+		 * the query is not walked, nor copied. Entities added by handlers
+		 * during the run are not indexed yet, so they wait for the next
+		 * frame.
+		 * @param query The query listing the interactive entities.
+		 */
+		void updateQuery(const ecs::EntityQuery &query) override;
 	};
 
 }	 // namespace guillaume::systems
\ No newline at end of file
@@ -40,7 +40,8 @@ namespace guillaume::systems
 	 * @see components::Text
 	 */
 	class KeyboardControl:
-		public ecs::SystemFiller<components::Text, components::Focus>
+		public ecs::SystemFiller<ecs::Writes<components::Text>,
+								 ecs::Reads<components::Focus>>
 	{
 		private:
 		event::EventSubscriber<utility::event::KeyboardEvent>
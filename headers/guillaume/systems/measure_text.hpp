@@ -42,7 +42,8 @@ namespace guillaume::systems
 	 * @see components::Transform
 	 */
 	class MeasureText:
-		public ecs::SystemFiller<components::Text, components::Bound>
+		public ecs::SystemFiller<ecs::Reads<components::Text>,
+								 ecs::Writes<components::Bound>>
 	{
 		private:
 		Renderer &_renderer;	///< Renderer instance
@@ -66,6 +67,13 @@ namespace guillaume::systems
 		 * @param entityIdentifier The target entity identifier.
 		 */
 		void update(const ecs::Entity::Identifier &entityIdentifier) override;
+
+		/**
+		 * @brief Measure the text of a batch of entities.
+		 * @param entities The target entity identifiers.
+		 */
+		void updateBatch(
+			std::span<const ecs::Entity::Identifier> entities) override;
 	};
 
 }	 // namespace guillaume::systems
@@ -42,14 +42,21 @@ namespace guillaume::systems
 	 * @see components::Borders
 	 */
 	class RectangleRender:
-		public ecs::SystemFiller<components::Transform, components::Bound,
-								 components::Color, components::Borders>
+		public ecs::SystemFiller<
+			ecs::Reads<components::Transform, components::Bound,
+					   components::Color, components::Borders>>
 	{
 		private:
 		Renderer &_renderer;	///< Renderer instance
-		std::vector<utility::graphic::VertexF>
-			_vertices;	  ///< Reused draw buffer to avoid per-frame
-						  ///< allocations.
+		std::vector<std::vector<utility::graphic::VertexF>>
+			_entityVertices;	///< Reused per-entity draw buffers to avoid
+								///< per-frame allocations.
+
+		/**
+		 * @brief Number of entities whose vertices are built per parallel
+		 * job.
+		 */
+		constexpr static std::size_t VertexBuildChunkSize = 32;
 
 		private:
 		/**
@@ -137,19 +144,35 @@ namespace guillaume::systems
 			const utility::graphic::OrientationF &orientation,
 			const utility::math::Vector2F &scale,
 			const utility::math::Vector2F &size, float radius,
-			int arcSegments = 16, float epsilon = 0.001f);
+			int arcSegments = 16, float epsilon = 0.001f) const;
 
 		/**
 		 * @brief Convert an outline to OpenGL triangle fan vertices.
 		 * @param center Fan anchor.
 		 * @param outline Outline vertices in draw order.
 		 * @param color Vertex color.
-		 * @note This method appends into the internal _vertices buffer.
+		 * @param vertices Buffer the fan vertices are appended to.
 		 */
 		void buildTriangleFanVertices(
 			const utility::graphic::PositionF &center,
 			const std::vector<utility::graphic::PositionF> &outline,
-			const utility::graphic::Color32Bit &color);
+			const utility::graphic::Color32Bit &color,
+			std::vector<utility::graphic::VertexF> &vertices) const;
+
+		/**
+		 * @brief Build the triangle fan of one entity's rectangle.
+		 * @param transform Transform component.
+		 * @param bound Bound component.
+		 * @param color Color component.
+		 * @param borders Borders component.
+		 * @param vertices Buffer replaced with the fan vertices.
+		 * @note Only reads its arguments, so it can run concurrently.
+		 */
+		void buildEntityVertices(
+			const components::Transform &transform,
+			const components::Bound &bound, const components::Color &color,
+			const components::Borders &borders,
+			std::vector<utility::graphic::VertexF> &vertices) const;
 
 		/**
 		 * @brief Create one drawable vertex from a 2D point and color.
@@ -178,6 +201,16 @@ namespace guillaume::systems
 		 * @param entityIdentifier The target entity identifier.
 		 */
 		void update(const ecs::Entity::Identifier &entityIdentifier) override;
+
+		/**
+		 * @brief Draw the rectangles of a batch of entities.
+		 *
+		 * Vertices are built in parallel, then appended in entity order to
+		 * the renderer's command list, which draws them in one batch.
+		 * @param entities The target entity identifiers.
+		 */
+		void updateBatch(
+			std::span<const ecs::Entity::Identifier> entities) override;
 	};
 
 }	 // namespace guillaume::systems
\ No newline at end of file
@@ -39,8 +39,8 @@ namespace guillaume::systems
 	 * @see components::Transform
 	 */
 	class TextRender:
-		public ecs::SystemFiller<components::Transform, components::Text,
-								 components::Color>
+		public ecs::SystemFiller<ecs::Reads<
+			components::Transform, components::Text, components::Color>>
 	{
 		private:
 		Renderer &_renderer;			 ///< Renderer instance
@@ -26,37 +26,9 @@ namespace guillaume::components
 {
 	Interaction::Interaction(void)
 	{
-		_onMouseHover	= nullptr;
-		_onMouseUnhover = nullptr;
-		_isMouseHovered = false;
-
-		for (const auto button:
-			 { utility::event::MouseButtonEvent::Button::Left,
-			   utility::event::MouseButtonEvent::Button::Middle,
-			   utility::event::MouseButtonEvent::Button::Right,
-			   utility::event::MouseButtonEvent::Button::X1,
-			   utility::event::MouseButtonEvent::Button::X2 }) {
-			_isMouseButtonClicked[button]			   = false;
-			_onMouseButtonClickHandlers[button]		   = nullptr;
-			_onMouseButtonClickReleaseHandlers[button] = nullptr;
-		}
-
-		for (const auto button:
-			 { utility::event::HandButtonEvent::Button::X,
-			   utility::event::HandButtonEvent::Button::Y,
-			   utility::event::HandButtonEvent::Button::A,
-			   utility::event::HandButtonEvent::Button::B,
-			   utility::event::HandButtonEvent::Button::Menu,
-			   utility::event::HandButtonEvent::Button::System }) {
-			_isHandButtonClicked[button]				= false;
-			_onHandButtonClickHandlers[button]		= nullptr;
-			_onHandButtonClickReleaseHandlers[button] = nullptr;
-		}
-
-		_onHandPinchHandler = nullptr;
-		_isHandPinched		= false;
-		_onHandPokeHandler	= nullptr;
-		_isHandPoked		= false;
+		// A new Interaction is a change, so that the Interaction system
+		// finds it in the change log and indexes it without a rebuild.
+		setHasChanged(true);
 	}
 
 	Interaction &
@@ -75,13 +47,13 @@ namespace guillaume::components
 		return *this;
 	}
 
-	Interaction::MouseHoverHandler
+	const Interaction::MouseHoverHandler &
 		Interaction::getMouseOnHoverHandler(void) const
 	{
 		return _onMouseHover;
 	}
 
-	Interaction::MouseUnhoverHandler
+	const Interaction::MouseUnhoverHandler &
 		Interaction::getMouseOnUnhoverHandler(void) const
 	{
 		return _onMouseUnhover;
@@ -106,7 +78,7 @@ namespace guillaume::components
 		const utility::event::MouseButtonEvent::Button &button,
 		const MouseButtonClickHandler &handler)
 	{
-		_onMouseButtonClickHandlers[button] = handler;
+		_onMouseButtonClickHandlers[static_cast<std::size_t>(button)] = handler;
 		setHasChanged(true);
 		return *this;
 	}
@@ -115,39 +87,48 @@ namespace guillaume::components
 		const utility::event::MouseButtonEvent::Button &button,
 		const MouseButtonClickReleaseHandler &handler)
 	{
-		_onMouseButtonClickReleaseHandlers[button] = handler;
+		_onMouseButtonClickReleaseHandlers[static_cast<std::size_t>(button)] =
+			handler;
 		setHasChanged(true);
 		return *this;
 	}
 
-	const std::map<utility::event::MouseButtonEvent::Button,
-				   Interaction::MouseButtonClickHandler> &
-		Interaction::getMouseButtonOnClickHandlers() const
+	const Interaction::MouseButtonClickHandler &
+		Interaction::getMouseButtonOnClickHandler(
+			const utility::event::MouseButtonEvent::Button &button) const
 	{
-		return _onMouseButtonClickHandlers;
+		return _onMouseButtonClickHandlers.at(static_cast<std::size_t>(button));
 	}
 
-	const std::map<utility::event::MouseButtonEvent::Button,
-				   Interaction::MouseButtonClickReleaseHandler> &
-		Interaction::getMouseButtonOnClickReleaseHandlers() const
+	const Interaction::MouseButtonClickReleaseHandler &
+		Interaction::getMouseButtonOnClickReleaseHandler(
+			const utility::event::MouseButtonEvent::Button &button) const
 	{
-		return _onMouseButtonClickReleaseHandlers;
+		return _onMouseButtonClickReleaseHandlers.at(
+			static_cast<std::size_t>(button));
+	}
+
+	const Interaction::MouseButtons &
+		Interaction::getMouseButtonsClicked(void) const
+	{
+		return _mouseButtonsClicked;
 	}
 
 	bool Interaction::isMouseButtonClicked(
 		const utility::event::MouseButtonEvent::Button &button) const
 	{
-		return _isMouseButtonClicked.at(button);
+		return _mouseButtonsClicked.test(static_cast<std::size_t>(button));
 	}
 
 	Interaction &Interaction::setMouseButtonClicked(
 		const utility::event::MouseButtonEvent::Button &button,
 		bool clicked)
 	{
-		if (_isMouseButtonClicked[button] == clicked) {
+		const auto index = static_cast<std::size_t>(button);
+		if (_mouseButtonsClicked.test(index) == clicked) {
 			return *this;
 		}
-		_isMouseButtonClicked[button] = clicked;
+		_mouseButtonsClicked.set(index, clicked);
 		setHasChanged(true);
 		return *this;
 	}
@@ -156,7 +137,7 @@ namespace guillaume::components
 		const utility::event::HandButtonEvent::Button &button,
 		const HandButtonClickHandler &handler)
 	{
-		_onHandButtonClickHandlers[button] = handler;
+		_onHandButtonClickHandlers[static_cast<std::size_t>(button)] = handler;
 		setHasChanged(true);
 		return *this;
 	}
@@ -165,39 +146,48 @@ namespace guillaume::components
 		const utility::event::HandButtonEvent::Button &button,
 		const HandButtonClickReleaseHandler &handler)
 	{
-		_onHandButtonClickReleaseHandlers[button] = handler;
+		_onHandButtonClickReleaseHandlers[static_cast<std::size_t>(button)] =
+			handler;
 		setHasChanged(true);
 		return *this;
 	}
 
-	const std::map<utility::event::HandButtonEvent::Button,
-				   Interaction::HandButtonClickHandler> &
-		Interaction::getHandButtonOnClickHandlers() const
+	const Interaction::HandButtonClickHandler &
+		Interaction::getHandButtonOnClickHandler(
+			const utility::event::HandButtonEvent::Button &button) const
+	{
+		return _onHandButtonClickHandlers.at(static_cast<std::size_t>(button));
+	}
+
+	const Interaction::HandButtonClickReleaseHandler &
+		Interaction::getHandButtonOnClickReleaseHandler(
+			const utility::event::HandButtonEvent::Button &button) const
 	{
-		return _onHandButtonClickHandlers;
+		return _onHandButtonClickReleaseHandlers.at(
+			static_cast<std::size_t>(button));
 	}
 
-	const std::map<utility::event::HandButtonEvent::Button,
-				   Interaction::HandButtonClickReleaseHandler> &
-		Interaction::getHandButtonOnClickReleaseHandlers() const
+	const Interaction::HandButtons &
+		Interaction::getHandButtonsClicked(void) const
 	{
-		return _onHandButtonClickReleaseHandlers;
+		return _handButtonsClicked;
 	}
 
 	bool Interaction::isHandButtonClicked(
 		const utility::event::HandButtonEvent::Button &button) const
 	{
-		return _isHandButtonClicked.at(button);
+		return _handButtonsClicked.test(static_cast<std::size_t>(button));
 	}
 
 	Interaction &Interaction::setHandButtonClicked(
 		const utility::event::HandButtonEvent::Button &button,
 		bool clicked)
 	{
-		if (_isHandButtonClicked[button] == clicked) {
+		const auto index = static_cast<std::size_t>(button);
+		if (_handButtonsClicked.test(index) == clicked) {
 			return *this;
 		}
-		_isHandButtonClicked[button] = clicked;
+		_handButtonsClicked.set(index, clicked);
 		setHasChanged(true);
 		return *this;
 	}
@@ -218,13 +208,13 @@ namespace guillaume::components
 		return *this;
 	}
 
-	Interaction::HandHoverHandler
+	const Interaction::HandHoverHandler &
 		Interaction::getHandOnHoverHandler(void) const
 	{
 		return _onHandHover;
 	}
 
-	Interaction::HandUnhoverHandler
+	const Interaction::HandUnhoverHandler &
 		Interaction::getHandOnUnhoverHandler(void) const
 	{
 		return _onHandUnhover;
@@ -253,7 +243,8 @@ namespace guillaume::components
 		return *this;
 	}
 
-	Interaction::HandPinchHandler Interaction::getHandPinchHandler(void) const
+	const Interaction::HandPinchHandler &
+		Interaction::getHandPinchHandler(void) const
 	{
 		return _onHandPinchHandler;
 	}
@@ -280,11 +271,27 @@ namespace guillaume::components
 		return *this;
 	}
 
-	Interaction::HandPokeHandler Interaction::getHandPokeHandler(void) const
+	const Interaction::HandPokeHandler &
+		Interaction::getHandPokeHandler(void) const
 	{
 		return _onHandPokeHandler;
 	}
 
+	bool Interaction::isHandPoked(void) const
+	{
+		return _isHandPoked;
+	}
+
+	Interaction &Interaction::setHandPoked(bool isPoked)
+	{
+		if (_isHandPoked == isPoked) {
+			return *this;
+		}
+		_isHandPoked = isPoked;
+		setHasChanged(true);
+		return *this;
+	}
+
 	const utility::math::Vector2F &Interaction::getAccessibilityMargin() const
 	{
 		return _accessibilityMargin;
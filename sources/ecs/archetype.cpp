@@ -0,0 +1,98 @@
+/*
+ Copyright (c) 2026 ETIB Corporation
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy of
+ this software and associated documentation files (the "Software"), to deal in
+ the Software without restriction, including without limitation the rights to
+ use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ of the Software, and to permit persons to whom the Software is furnished to do
+ so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in all
+ copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ SOFTWARE.
+ */
+
+#include "guillaume/ecs/archetype.hpp"
+
+#include <utility>
+
+namespace guillaume::ecs
+{
+
+	Archetype::Archetype(const Entity::Signature &signature,
+						 std::vector<IComponentStorage *> storages)
+		: _signature(signature)
+		, _storages(std::move(storages))
+	{
+		if (_storages.empty()) {
+			return;
+		}
+		const auto identifiers = _storages.front()->getIdentifiers();
+		for (const auto &entityIdentifier: identifiers) {
+			refresh(entityIdentifier);
+		}
+	}
+
+	const Entity::Signature &Archetype::getSignature(void) const
+	{
+		return _signature;
+	}
+
+	std::size_t Archetype::size(void) const
+	{
+		return _size;
+	}
+
+	std::span<const Entity::Identifier> Archetype::getIdentifiers(void) const
+	{
+		if (_storages.empty()) {
+			return {};
+		}
+		return std::span<const Entity::Identifier>(
+			_storages.front()->getIdentifiers().data(), _size);
+	}
+
+	bool Archetype::contains(const Entity::Identifier &entityIdentifier) const
+	{
+		if (_storages.empty()) {
+			return false;
+		}
+		return _storages.front()->getIndex(entityIdentifier) < _size;
+	}
+
+	void Archetype::refresh(const Entity::Identifier &entityIdentifier)
+	{
+		if (_storages.empty() || contains(entityIdentifier)) {
+			return;
+		}
+		for (const auto *storage: _storages) {
+			if (!storage->has(entityIdentifier)) {
+				return;
+			}
+		}
+		for (auto *storage: _storages) {
+			storage->swapIndices(storage->getIndex(entityIdentifier), _size);
+		}
+		++_size;
+	}
+
+	void Archetype::erase(const Entity::Identifier &entityIdentifier)
+	{
+		if (!contains(entityIdentifier)) {
+			return;
+		}
+		--_size;
+		for (auto *storage: _storages) {
+			storage->swapIndices(storage->getIndex(entityIdentifier), _size);
+		}
+	}
+
+}	 // namespace guillaume::ecs
@@ -0,0 +1,83 @@
+/*
+ Copyright (c) 2026 ETIB Corporation
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy of
+ this software and associated documentation files (the "Software"), to deal in
+ the Software without restriction, including without limitation the rights to
+ use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ of the Software, and to permit persons to whom the Software is furnished to do
+ so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in all
+ copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ SOFTWARE.
+ */
+
+#include "guillaume/ecs/change_log.hpp"
+
+#include <algorithm>
+
+namespace guillaume::ecs
+{
+
+	namespace
+	{
+		bool isBeforeFrame(const ChangeLog::Entry &entry,
+						   ChangeLog::Frame frame)
+		{
+			return entry.frame < frame;
+		}
+	}	 // namespace
+
+	ChangeLog::ChangeLog(ChangeTracker *tracker, bool tracksPending)
+		: _tracker(tracker)
+		, _tracksPending(tracksPending)
+	{
+	}
+
+	void ChangeLog::record(const Entity::Identifier &entityIdentifier)
+	{
+		const Frame frame = _tracker != nullptr ? _tracker->getFrame() : 0;
+		_entries.push_back({ entityIdentifier, frame });
+		if (!_tracksPending) {
+			_pendingBegin = _entries.size();
+		} else if (_tracker != nullptr) {
+			_tracker->record(entityIdentifier);
+		}
+	}
+
+	std::span<const ChangeLog::Entry> ChangeLog::getPending(void) const
+	{
+		return std::span<const Entry>(_entries).subspan(_pendingBegin);
+	}
+
+	void ChangeLog::markHandled(void)
+	{
+		_pendingBegin = _entries.size();
+	}
+
+	std::span<const ChangeLog::Entry> ChangeLog::getSince(Frame frame) const
+	{
+		const auto first = std::lower_bound(_entries.begin(), _entries.end(),
+											frame, isBeforeFrame);
+		return std::span<const Entry>(first, _entries.end());
+	}
+
+	void ChangeLog::discardBefore(Frame frame)
+	{
+		const auto handledEnd =
+			_entries.begin() + static_cast<std::ptrdiff_t>(_pendingBegin);
+		const auto last = std::lower_bound(_entries.begin(), handledEnd,
+										   frame, isBeforeFrame);
+		_pendingBegin -= static_cast<std::size_t>(last - _entries.begin());
+		_entries.erase(_entries.begin(), last);
+	}
+
+}	 // namespace guillaume::ecs
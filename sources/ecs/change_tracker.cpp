@@ -0,0 +1,58 @@
+/*
+ Copyright (c) 2026 ETIB Corporation
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy of
+ this software and associated documentation files (the "Software"), to deal in
+ the Software without restriction, including without limitation the rights to
+ use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ of the Software, and to permit persons to whom the Software is furnished to do
+ so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in all
+ copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ SOFTWARE.
+ */
+
+#include "guillaume/ecs/change_tracker.hpp"
+
+namespace guillaume::ecs
+{
+
+	ChangeTracker::Frame ChangeTracker::getFrame(void) const
+	{
+		return _frame;
+	}
+
+	void ChangeTracker::advanceFrame(void)
+	{
+		++_frame;
+	}
+
+	void ChangeTracker::record(const Entity::Identifier &entityIdentifier)
+	{
+		std::lock_guard<std::mutex> lock(_mutex);
+		if (_pendingLookup.insert(entityIdentifier).second) {
+			_pendingEntities.push_back(entityIdentifier);
+		}
+	}
+
+	const std::vector<Entity::Identifier> &
+		ChangeTracker::getPendingEntities(void) const
+	{
+		return _pendingEntities;
+	}
+
+	void ChangeTracker::clearPending(void)
+	{
+		_pendingEntities.clear();
+		_pendingLookup.clear();
+	}
+
+}	 // namespace guillaume::ecs
@@ -0,0 +1,124 @@
+/*
+ Copyright (c) 2026 ETIB Corporation
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy of
+ this software and associated documentation files (the "Software"), to deal in
+ the Software without restriction, including without limitation the rights to
+ use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ of the Software, and to permit persons to whom the Software is furnished to do
+ so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in all
+ copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ SOFTWARE.
+ */
+
+#include "guillaume/ecs/command_buffer.hpp"
+
+#include <iterator>
+
+namespace guillaume::ecs
+{
+
+	void CommandBuffer::push(Command command)
+	{
+		std::lock_guard lock(_mutex);
+		_commands.push_back(std::move(command));
+	}
+
+	void CommandBuffer::createEntity(Factory factory, EntityRegistry *parent)
+	{
+		Command command = [factory = std::move(factory), parent](
+							  ComponentRegistry &componentRegistry,
+							  EntityRegistry &entityRegistry) {
+			EntityRegistry &target = parent != nullptr ? *parent
+													   : entityRegistry;
+			target.addEntity(factory(componentRegistry));
+		};
+
+		std::lock_guard lock(_mutex);
+		++_createdEntities[parent];
+		_commands.push_back(std::move(command));
+	}
+
+	void CommandBuffer::destroyEntity(
+		const Entity::Identifier &entityIdentifier)
+	{
+		push([entityIdentifier](ComponentRegistry &componentRegistry,
+								EntityRegistry &entityRegistry) {
+			entityRegistry.destroyEntity(entityIdentifier, componentRegistry);
+		});
+	}
+
+	void CommandBuffer::record(Command command)
+	{
+		push(std::move(command));
+	}
+
+	bool CommandBuffer::empty(void) const
+	{
+		std::lock_guard lock(_mutex);
+		return _commands.empty();
+	}
+
+	std::size_t CommandBuffer::size(void) const
+	{
+		std::lock_guard lock(_mutex);
+		return _commands.size();
+	}
+
+	void CommandBuffer::apply(ComponentRegistry &componentRegistry,
+							  EntityRegistry &entityRegistry)
+	{
+		std::vector<Command> commands;
+		std::unordered_map<EntityRegistry *, std::size_t> createdEntities;
+		std::unordered_map<std::size_t, std::size_t> addedComponents;
+
+		// Commands may record further commands, which are applied in a
+		// following batch.
+		while (true) {
+			{
+				std::lock_guard lock(_mutex);
+				if (_commands.empty()) {
+					return;
+				}
+				commands.swap(_commands);
+				createdEntities.swap(_createdEntities);
+				addedComponents.swap(_addedComponents);
+			}
+
+			for (const auto &[parent, count]: createdEntities) {
+				(parent != nullptr ? *parent : entityRegistry)
+					.reserveEntities(count);
+			}
+			for (const auto &[typeId, count]: addedComponents) {
+				componentRegistry.reserveComponents(typeId, count);
+			}
+			for (auto iterator = commands.begin(); iterator != commands.end();
+				 ++iterator) {
+				try {
+					(*iterator)(componentRegistry, entityRegistry);
+				} catch (...) {
+					const auto remaining = std::next(iterator);
+					std::lock_guard lock(_mutex);
+					_commands.insert(_commands.begin(),
+									 std::make_move_iterator(remaining),
+									 std::make_move_iterator(commands.end()));
+					throw;
+				}
+			}
+
+			commands.clear();
+			createdEntities.clear();
+			addedComponents.clear();
+		}
+	}
+
+}	 // namespace guillaume::ecs
@@ -22,6 +22,8 @@
 
 #include "guillaume/ecs/component.hpp"
 
+#include "guillaume/ecs/change_log.hpp"
+
 namespace guillaume::ecs
 {
 	bool Component::hasChanged(void) const
@@ -31,6 +33,18 @@ namespace guillaume::ecs
 
 	void Component::setHasChanged(bool hasChanged)
 	{
+		if (hasChanged && !_hasChanged && _changeLog != nullptr) {
+			_changeLog->record(_owner);
+		}
 		_hasChanged = hasChanged;
 	}
+
+	void Component::attachChangeLog(ChangeLog *changeLog, std::size_t owner)
+	{
+		_changeLog = changeLog;
+		_owner	   = owner;
+		if (_hasChanged && _changeLog != nullptr) {
+			_changeLog->record(_owner);
+		}
+	}
 }	 // namespace guillaume::ecs
\ No newline at end of file
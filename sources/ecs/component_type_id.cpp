@@ -22,6 +22,10 @@
 
 #include "guillaume/ecs/component_type_id.hpp"
 
+#include <algorithm>
+#include <array>
+#include <atomic>
+
 namespace guillaume::ecs
 {
 	ComponentTypeLimitExceededException::
@@ -35,12 +39,49 @@ namespace guillaume::ecs
 		return _message.c_str();
 	}
 
-	std::size_t ComponentTypeId::nextId(void)
+	namespace
+	{
+
+		/**
+		 * @brief Stable id of each dense id handed out so far.
+		 */
+		struct RegisteredTypes {
+			std::atomic<std::size_t> count { 0 };	 ///< Dense ids handed out
+			std::array<std::atomic<ComponentTypeId::StableId>,
+					   MaxComponentTypes>
+				stableIds {};	 ///< Stable id of each dense id, 0 until set
+		};
+
+		RegisteredTypes &getRegisteredTypes(void)
+		{
+			static RegisteredTypes types;
+			return types;
+		}
+
+	}	 // namespace
+
+	std::size_t ComponentTypeId::find(StableId stableId)
+	{
+		auto &types				= getRegisteredTypes();
+		const std::size_t count = std::min(
+			types.count.load(std::memory_order_acquire), MaxComponentTypes);
+		for (std::size_t id = 0; id < count; ++id) {
+			if (types.stableIds[id].load(std::memory_order_acquire)
+				== stableId) {
+				return id;
+			}
+		}
+		return InvalidId;
+	}
+
+	std::size_t ComponentTypeId::registerType(StableId stableId)
 	{
-		static std::size_t currentId = 0;
-		if (currentId >= MaxComponentTypes) {
+		auto &types			 = getRegisteredTypes();
+		const std::size_t id = types.count.fetch_add(1);
+		if (id >= MaxComponentTypes) {
 			throw ComponentTypeLimitExceededException();
 		}
-		return currentId++;
+		types.stableIds[id].store(stableId, std::memory_order_release);
+		return id;
 	}
 }	 // namespace guillaume::ecs
\ No newline at end of file
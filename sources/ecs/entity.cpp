@@ -22,18 +22,107 @@
 
 #include "guillaume/ecs/entity.hpp"
 
+#include <mutex>
+#include <vector>
+
+#include "guillaume/ecs/entity_pool.hpp"
+#include "guillaume/ecs/entity_registry.hpp"
+
 namespace guillaume::ecs
 {
 
-	Entity::Identifier Entity::getNextIdentifier(void)
+	namespace
+	{
+
+		/**
+		 * @brief Generations of every slot and the slots free for reuse.
+		 */
+		struct IdentifierSlots {
+			std::mutex mutex;	 ///< Guards concurrent entity creation
+			std::vector<Entity::Generation>
+				generations;	///< Current generation of each slot
+			std::vector<Entity::Slot> freeSlots;	///< Released slots
+		};
+
+		IdentifierSlots &getIdentifierSlots(void)
+		{
+			// Never destroyed, so entities outliving static destruction can
+			// still release their identifier.
+			static auto *slots = new IdentifierSlots();
+			return *slots;
+		}
+
+	}	 // namespace
+
+	Entity::Identifier Entity::acquireIdentifier(void)
 	{
-		static Identifier currentId = InvalidIdentifier;
-		return ++currentId;
+		auto &slots = getIdentifierSlots();
+		std::lock_guard lock(slots.mutex);
+
+		if (slots.freeSlots.empty()) {
+			const auto slot = static_cast<Slot>(slots.generations.size());
+			slots.generations.push_back(1);
+			return makeIdentifier(slot, 1);
+		}
+		const Slot slot = slots.freeSlots.back();
+		slots.freeSlots.pop_back();
+		return makeIdentifier(slot, slots.generations[slot]);
+	}
+
+	void Entity::releaseIdentifier(const Identifier &identifier)
+	{
+		auto &slots = getIdentifierSlots();
+		std::lock_guard lock(slots.mutex);
+
+		const Slot slot		   = getSlot(identifier);
+		Generation &generation = slots.generations[slot];
+		// Generation 0 is kept for InvalidIdentifier.
+		if (++generation == 0) {
+			generation = 1;
+		}
+		slots.freeSlots.push_back(slot);
+	}
+
+	bool Entity::isAlive(const Identifier &identifier)
+	{
+		auto &slots = getIdentifierSlots();
+		std::lock_guard lock(slots.mutex);
+
+		const Slot slot = getSlot(identifier);
+		return slot < slots.generations.size()
+			&& slots.generations[slot] == getGeneration(identifier);
 	}
 
 	Entity::Entity(void)
-		: _identifier(getNextIdentifier())
+		: _identifier(acquireIdentifier())
+	{
+	}
+
+	Entity::~Entity(void)
 	{
+		releaseIdentifier(_identifier);
+	}
+
+	void *Entity::operator new(std::size_t size)
+	{
+		return EntityPool::getInstance().allocate(size);
+	}
+
+	void Entity::operator delete(void *pointer, std::size_t size)
+	{
+		EntityPool::getInstance().deallocate(pointer, size);
+	}
+
+	void *Entity::operator new(std::size_t size, std::align_val_t alignment)
+	{
+		return EntityPool::getInstance().allocate(size, alignment);
+	}
+
+	void Entity::operator delete(void *pointer,
+								 std::size_t size,
+								 std::align_val_t alignment)
+	{
+		EntityPool::getInstance().deallocate(pointer, size, alignment);
 	}
 
 	Entity::Identifier Entity::getIdentifier(void) const
@@ -49,10 +138,23 @@ namespace guillaume::ecs
 	void Entity::setSignature(const Signature &signature)
 	{
 		_signature = signature;
+		if (_owner != nullptr) {
+			_owner->onEntitySignatureChanged(*this);
+		}
 	}
 
 	void Entity::update(void)
 	{
 	}
 
+	EntityRegistry *Entity::asEntityRegistry(void)
+	{
+		return nullptr;
+	}
+
+	const EntityRegistry *Entity::asEntityRegistry(void) const
+	{
+		return nullptr;
+	}
+
 }	 // namespace guillaume::ecs
\ No newline at end of file
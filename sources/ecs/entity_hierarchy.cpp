@@ -0,0 +1,186 @@
+/*
+ Copyright (c) 2026 ETIB Corporation
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy of
+ this software and associated documentation files (the "Software"), to deal in
+ the Software without restriction, including without limitation the rights to
+ use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ of the Software, and to permit persons to whom the Software is furnished to do
+ so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in all
+ copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ SOFTWARE.
+ */
+
+#include "guillaume/ecs/entity_hierarchy.hpp"
+
+#include <algorithm>
+
+namespace guillaume::ecs
+{
+
+	EntityHierarchy::EntityHierarchy(void)
+		: _entities { nullptr }
+		, _parents { InvalidNode }
+		, _firstChildren { InvalidNode }
+		, _lastChildren { InvalidNode }
+		, _previousSiblings { InvalidNode }
+		, _nextSiblings { InvalidNode }
+		, _depths { 0 }
+		, _insertionOrders { 0 }
+	{
+	}
+
+	EntityHierarchy::Node EntityHierarchy::insert(Node parent, Entity &entity)
+	{
+		Node node;
+		if (_freeNodes.empty()) {
+			node = static_cast<Node>(_entities.size());
+			_entities.push_back(&entity);
+			_parents.push_back(parent);
+			_firstChildren.push_back(InvalidNode);
+			_lastChildren.push_back(InvalidNode);
+			_previousSiblings.push_back(_lastChildren[parent]);
+			_nextSiblings.push_back(InvalidNode);
+			_depths.push_back(_depths[parent] + 1);
+			_insertionOrders.push_back(_nextInsertionOrder++);
+		} else {
+			node = _freeNodes.back();
+			_freeNodes.pop_back();
+			_entities[node]			= &entity;
+			_parents[node]			= parent;
+			_firstChildren[node]	= InvalidNode;
+			_lastChildren[node]		= InvalidNode;
+			_previousSiblings[node]	= _lastChildren[parent];
+			_nextSiblings[node]		= InvalidNode;
+			_depths[node]			= _depths[parent] + 1;
+			_insertionOrders[node]	= _nextInsertionOrder++;
+		}
+
+		if (_lastChildren[parent] == InvalidNode) {
+			_firstChildren[parent] = node;
+		} else {
+			_nextSiblings[_lastChildren[parent]] = node;
+		}
+		_lastChildren[parent]		   = node;
+		_nodes[entity.getIdentifier()] = node;
+		return node;
+	}
+
+	void EntityHierarchy::reserve(std::size_t additional)
+	{
+		const std::size_t requiredEntries = _nodes.size() + additional;
+		if (static_cast<float>(requiredEntries)
+			> static_cast<float>(_nodes.bucket_count())
+				  * _nodes.max_load_factor()) {
+			_nodes.reserve(std::max(_nodes.size() * 2, requiredEntries));
+		}
+
+		if (additional <= _freeNodes.size()) {
+			return;
+		}
+		const std::size_t required =
+			_entities.size() + additional - _freeNodes.size();
+		if (required <= _entities.capacity()) {
+			return;
+		}
+		const std::size_t capacity =
+			std::max(_entities.capacity() * 2, required);
+		_entities.reserve(capacity);
+		_parents.reserve(capacity);
+		_firstChildren.reserve(capacity);
+		_lastChildren.reserve(capacity);
+		_previousSiblings.reserve(capacity);
+		_nextSiblings.reserve(capacity);
+		_depths.reserve(capacity);
+		_insertionOrders.reserve(capacity);
+		_breadthFirstQueue.reserve(capacity);
+	}
+
+	void EntityHierarchy::erase(Node node)
+	{
+		const Node parent	= _parents[node];
+		const Node previous	= _previousSiblings[node];
+		const Node next		= _nextSiblings[node];
+
+		// Free the descendants while the links are still intact.
+		for (Node current = _firstChildren[node]; current != InvalidNode;
+			 current = getNextPreOrder(current, node)) {
+			_nodes.erase(_entities[current]->getIdentifier());
+			_entities[current] = nullptr;
+			_freeNodes.push_back(current);
+		}
+		_nodes.erase(_entities[node]->getIdentifier());
+		_entities[node] = nullptr;
+		_freeNodes.push_back(node);
+
+		if (previous == InvalidNode) {
+			_firstChildren[parent] = next;
+		} else {
+			_nextSiblings[previous] = next;
+		}
+		if (next == InvalidNode) {
+			_lastChildren[parent] = previous;
+		} else {
+			_previousSiblings[next] = previous;
+		}
+	}
+
+	EntityHierarchy::Node EntityHierarchy::find(
+		const Entity::Identifier &entityIdentifier) const
+	{
+		const auto iterator = _nodes.find(entityIdentifier);
+		if (iterator == _nodes.end()) {
+			return InvalidNode;
+		}
+		return iterator->second;
+	}
+
+	Entity &EntityHierarchy::getEntity(Node node) const
+	{
+		return *_entities[node];
+	}
+
+	EntityHierarchy::Node EntityHierarchy::getParent(Node node) const
+	{
+		return _parents[node];
+	}
+
+	EntityHierarchy::Node EntityHierarchy::getFirstChild(Node node) const
+	{
+		return _firstChildren[node];
+	}
+
+	EntityHierarchy::Node EntityHierarchy::getNextSibling(Node node) const
+	{
+		return _nextSiblings[node];
+	}
+
+	bool EntityHierarchy::isBreadthFirstBefore(Node first, Node second) const
+	{
+		if (_depths[first] != _depths[second]) {
+			return _depths[first] < _depths[second];
+		}
+		// Siblings are always appended, so their insertion order is their
+		// order in the hierarchy.
+		while (_parents[first] != _parents[second]) {
+			first  = _parents[first];
+			second = _parents[second];
+		}
+		return _insertionOrders[first] < _insertionOrders[second];
+	}
+
+	std::size_t EntityHierarchy::size(void) const
+	{
+		return _nodes.size();
+	}
+
+}	 // namespace guillaume::ecs
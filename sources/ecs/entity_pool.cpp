@@ -0,0 +1,174 @@
+/*
+ Copyright (c) 2026 ETIB Corporation
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy of
+ this software and associated documentation files (the "Software"), to deal in
+ the Software without restriction, including without limitation the rights to
+ use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ of the Software, and to permit persons to whom the Software is furnished to do
+ so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in all
+ copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ SOFTWARE.
+ */
+
+#include "guillaume/ecs/entity_pool.hpp"
+
+#include <algorithm>
+#include <functional>
+#include <new>
+
+namespace guillaume::ecs
+{
+
+	std::size_t EntityPool::getSizeClassIndex(std::size_t size)
+	{
+		return size == 0 ? 0 : (size - 1) / Granularity;
+	}
+
+	EntityPool &EntityPool::getInstance(void)
+	{
+		// Never destroyed, so entities outliving static destruction can
+		// still be freed.
+		static auto *pool = new EntityPool();
+		return *pool;
+	}
+
+	void *EntityPool::allocate(std::size_t size)
+	{
+		if (size > MaxPooledSize) {
+			return ::operator new(size);
+		}
+
+		const std::size_t index = getSizeClassIndex(size);
+		std::lock_guard lock(_mutex);
+		SizeClass &sizeClass = _sizeClasses[index];
+
+		if (sizeClass.freeObjects == nullptr) {
+			const std::size_t objectSize = (index + 1) * Granularity;
+			auto block =
+				std::make_unique<std::byte[]>(objectSize * ObjectsPerBlock);
+			// Link the objects so they are handed out in address order.
+			for (std::size_t object = ObjectsPerBlock; object-- > 0;) {
+				auto *freeObject = reinterpret_cast<FreeObject *>(
+					block.get() + object * objectSize);
+				freeObject->next	  = sizeClass.freeObjects;
+				sizeClass.freeObjects = freeObject;
+			}
+			sizeClass.blocks.push_back(std::move(block));
+		}
+
+		FreeObject *object	  = sizeClass.freeObjects;
+		sizeClass.freeObjects = object->next;
+		return object;
+	}
+
+	void *EntityPool::allocate(std::size_t size, std::align_val_t alignment)
+	{
+		if (static_cast<std::size_t>(alignment) <= Granularity) {
+			return allocate(size);
+		}
+		return ::operator new(size, alignment);
+	}
+
+	void EntityPool::deallocate(void *pointer, std::size_t size)
+	{
+		if (pointer == nullptr) {
+			return;
+		}
+		if (size > MaxPooledSize) {
+			::operator delete(pointer);
+			return;
+		}
+
+		std::lock_guard lock(_mutex);
+		SizeClass &sizeClass  = _sizeClasses[getSizeClassIndex(size)];
+		auto *object		  = static_cast<FreeObject *>(pointer);
+		object->next		  = sizeClass.freeObjects;
+		sizeClass.freeObjects = object;
+	}
+
+	void EntityPool::deallocate(void *pointer,
+								std::size_t size,
+								std::align_val_t alignment)
+	{
+		if (static_cast<std::size_t>(alignment) <= Granularity) {
+			deallocate(pointer, size);
+			return;
+		}
+		::operator delete(pointer, alignment);
+	}
+
+	std::size_t EntityPool::trim(void)
+	{
+		std::lock_guard lock(_mutex);
+		std::size_t releasedBlocks = 0;
+
+		for (auto &sizeClass: _sizeClasses) {
+			if (sizeClass.freeObjects == nullptr) {
+				continue;
+			}
+			auto &blocks = sizeClass.blocks;
+			std::sort(blocks.begin(), blocks.end(),
+					  [](const auto &left, const auto &right) {
+						  return std::less<>()(left.get(), right.get());
+					  });
+
+			// Find the block of a free object by its address.
+			const auto findBlock = [&blocks](const FreeObject *object) {
+				const auto *address =
+					reinterpret_cast<const std::byte *>(object);
+				const auto block = std::upper_bound(
+					blocks.begin(), blocks.end(), address,
+					[](const std::byte *value, const auto &candidate) {
+						return std::less<>()(value, candidate.get());
+					});
+				return static_cast<std::size_t>(block - blocks.begin()) - 1;
+			};
+
+			std::vector<std::size_t> freeCounts(blocks.size(), 0);
+			for (const FreeObject *object = sizeClass.freeObjects;
+				 object != nullptr; object = object->next) {
+				++freeCounts[findBlock(object)];
+			}
+
+			// Unlink the objects of the released blocks, then free them.
+			FreeObject **link = &sizeClass.freeObjects;
+			while (*link != nullptr) {
+				if (freeCounts[findBlock(*link)] == ObjectsPerBlock) {
+					*link = (*link)->next;
+				} else {
+					link = &(*link)->next;
+				}
+			}
+			std::size_t kept = 0;
+			for (std::size_t block = 0; block < blocks.size(); ++block) {
+				if (freeCounts[block] == ObjectsPerBlock) {
+					++releasedBlocks;
+				} else {
+					blocks[kept++] = std::move(blocks[block]);
+				}
+			}
+			blocks.resize(kept);
+		}
+		return releasedBlocks;
+	}
+
+	std::size_t EntityPool::getBlockCount(std::size_t size) const
+	{
+		if (size > MaxPooledSize) {
+			return 0;
+		}
+		std::lock_guard lock(_mutex);
+		return _sizeClasses[getSizeClassIndex(size)].blocks.size();
+	}
+
+}	 // namespace guillaume::ecs
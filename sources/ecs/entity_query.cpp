@@ -0,0 +1,197 @@
+/*
+ Copyright (c) 2026 ETIB Corporation
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy of
+ this software and associated documentation files (the "Software"), to deal in
+ the Software without restriction, including without limitation the rights to
+ use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ of the Software, and to permit persons to whom the Software is furnished to do
+ so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in all
+ copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ SOFTWARE.
+ */
+
+#include "guillaume/ecs/entity_query.hpp"
+
+#include <algorithm>
+
+namespace guillaume::ecs
+{
+
+	void EntityQuery::place(const Entity::Identifier &entityIdentifier,
+							const EntityHierarchy &hierarchy)
+	{
+		const auto isBefore = [&hierarchy](const Entity::Identifier &first,
+										   const Entity::Identifier &second) {
+			return hierarchy.isBreadthFirstBefore(hierarchy.find(first),
+												  hierarchy.find(second));
+		};
+
+		// Entities are mostly added after the ones already listed.
+		std::size_t position = _identifiers.size();
+		if (!_identifiers.empty()
+			&& !isBefore(_identifiers.back(), entityIdentifier)) {
+			position = static_cast<std::size_t>(
+				std::lower_bound(_identifiers.begin(), _identifiers.end(),
+								 entityIdentifier, isBefore)
+				- _identifiers.begin());
+		}
+		_identifiers.insert(
+			_identifiers.begin() + static_cast<std::ptrdiff_t>(position),
+			entityIdentifier);
+
+		const Entity::Slot slot = Entity::getSlot(entityIdentifier);
+		if (slot >= _positions.size()) {
+			_positions.resize(
+				std::max(_positions.size() * 2, std::size_t { slot } + 1),
+				InvalidPosition);
+		}
+		reindexFrom(position);
+		++_insertionCount;
+	}
+
+	void EntityQuery::removeAt(std::size_t position)
+	{
+		_positions[Entity::getSlot(_identifiers[position])] = InvalidPosition;
+		_identifiers.erase(_identifiers.begin()
+						   + static_cast<std::ptrdiff_t>(position));
+		reindexFrom(position);
+	}
+
+	void EntityQuery::reindexFrom(std::size_t position)
+	{
+		for (; position < _identifiers.size(); ++position) {
+			_positions[Entity::getSlot(_identifiers[position])] = position;
+		}
+	}
+
+	EntityQuery::EntityQuery(const Entity::Signature &signature)
+		: _signature(signature)
+	{
+	}
+
+	const Entity::Signature &EntityQuery::getSignature(void) const
+	{
+		return _signature;
+	}
+
+	bool EntityQuery::matches(const Entity::Signature &signature) const
+	{
+		return (signature & _signature) == _signature;
+	}
+
+	const EntityQuery::Identifiers &EntityQuery::getIdentifiers(void) const
+	{
+		return _identifiers;
+	}
+
+	std::size_t EntityQuery::size(void) const
+	{
+		return _identifiers.size();
+	}
+
+	std::size_t EntityQuery::getPosition(
+		const Entity::Identifier &entityIdentifier) const
+	{
+		const Entity::Slot slot = Entity::getSlot(entityIdentifier);
+		if (slot >= _positions.size()) {
+			return InvalidPosition;
+		}
+		const std::size_t position = _positions[slot];
+		// The slot may be listed under another generation.
+		if (position == InvalidPosition
+			|| _identifiers[position] != entityIdentifier) {
+			return InvalidPosition;
+		}
+		return position;
+	}
+
+	std::size_t EntityQuery::getInsertionCount(void) const
+	{
+		return _insertionCount;
+	}
+
+	void EntityQuery::collectMissing(
+		std::span<const Entity::Identifier> sortedIdentifiers,
+		Identifiers &missing) const
+	{
+		for (const auto &entityIdentifier: _identifiers) {
+			if (!std::binary_search(sortedIdentifiers.begin(),
+									sortedIdentifiers.end(),
+									entityIdentifier)) {
+				missing.push_back(entityIdentifier);
+			}
+		}
+	}
+
+	void EntityQuery::insert(const Entity &entity,
+							 const EntityHierarchy &hierarchy)
+	{
+		if (matches(entity.getSignature())
+			&& getPosition(entity.getIdentifier()) == InvalidPosition) {
+			place(entity.getIdentifier(), hierarchy);
+		}
+	}
+
+	void EntityQuery::refresh(const Entity &entity,
+							  const EntityHierarchy &hierarchy)
+	{
+		const std::size_t position = getPosition(entity.getIdentifier());
+		const bool isListed		   = position != InvalidPosition;
+		const bool isMatching	   = matches(entity.getSignature());
+
+		if (isListed && !isMatching) {
+			removeAt(position);
+		} else if (!isListed && isMatching) {
+			place(entity.getIdentifier(), hierarchy);
+		}
+	}
+
+	void EntityQuery::erase(const Entity::Identifier &entityIdentifier)
+	{
+		const std::size_t position = getPosition(entityIdentifier);
+		if (position != InvalidPosition) {
+			removeAt(position);
+		}
+	}
+
+	void EntityQuery::erase(
+		std::span<const Entity::Identifier> sortedIdentifiers)
+	{
+		std::size_t firstErased = _identifiers.size();
+		for (const auto &entityIdentifier: sortedIdentifiers) {
+			const std::size_t position = getPosition(entityIdentifier);
+			if (position != InvalidPosition) {
+				_positions[Entity::getSlot(entityIdentifier)] = InvalidPosition;
+				firstErased = std::min(firstErased, position);
+			}
+		}
+		if (firstErased == _identifiers.size()) {
+			return;
+		}
+
+		std::erase_if(_identifiers, [&sortedIdentifiers](const auto &entry) {
+			return std::binary_search(
+				sortedIdentifiers.begin(), sortedIdentifiers.end(), entry);
+		});
+		reindexFrom(firstErased);
+	}
+
+	void EntityQuery::clear(void)
+	{
+		for (const auto &entityIdentifier: _identifiers) {
+			_positions[Entity::getSlot(entityIdentifier)] = InvalidPosition;
+		}
+		_identifiers.clear();
+	}
+
+}	 // namespace guillaume::ecs
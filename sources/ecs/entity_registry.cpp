@@ -22,35 +22,144 @@
 
 #include "guillaume/ecs/entity_registry.hpp"
 
+#include <algorithm>
+
+#include "guillaume/ecs/component_registry.hpp"
+
 namespace guillaume::ecs
 {
 
+	EntityHierarchy::Node
+		EntityRegistry::findRegistryNode(const EntityRegistry &registry) const
+	{
+		if (&registry == this) {
+			return EntityHierarchy::RootNode;
+		}
+		return _hierarchy.find(registry._registryEntity->getIdentifier());
+	}
+
+	void EntityRegistry::indexSubtree(EntityHierarchy::Node parent,
+									  Entity &entity)
+	{
+		const auto node = _hierarchy.insert(parent, entity);
+		for (auto &query: _queries) {
+			query->insert(entity, _hierarchy);
+		}
+
+		auto *childRegistry = entity.asEntityRegistry();
+		if (childRegistry == nullptr) {
+			return;
+		}
+		for (auto &child: childRegistry->accessDirectEntities()) {
+			indexSubtree(node, *child);
+		}
+	}
+
+	void EntityRegistry::unindexSubtree(
+		EntityHierarchy::Node node,
+		const std::vector<Entity::Identifier> &sortedIdentifiers)
+	{
+		_hierarchy.erase(node);
+		for (auto &query: _queries) {
+			query->erase(sortedIdentifiers);
+		}
+	}
+
+	void EntityRegistry::onEntitySignatureChanged(const Entity &entity)
+	{
+		for (EntityRegistry *registry = this; registry != nullptr;
+			 registry = registry->_parentRegistry) {
+			for (auto &query: registry->_queries) {
+				query->refresh(entity, registry->_hierarchy);
+			}
+		}
+	}
+
 	void EntityRegistry::addEntity(std::unique_ptr<Entity> entity)
 	{
+		Entity &addedEntity = *entity;
+		addedEntity._owner	= this;
+
+		auto *childRegistry = addedEntity.asEntityRegistry();
+		if (childRegistry != nullptr) {
+			childRegistry->_parentRegistry = this;
+			childRegistry->_registryEntity = &addedEntity;
+		}
+
 		accessDirectEntities().push_back(std::move(entity));
+
+		for (EntityRegistry *registry = this; registry != nullptr;
+			 registry = registry->_parentRegistry) {
+			registry->indexSubtree(registry->findRegistryNode(*this),
+								   addedEntity);
+		}
 	}
 
-	std::vector<Entity *> EntityRegistry::getEntitiesBreadthFirst(void)
+	void EntityRegistry::reserveEntities(std::size_t additional)
 	{
-		std::vector<Entity *> entities;
-		std::queue<EntityRegistry *> registries;
+		auto &entities			   = accessDirectEntities();
+		const std::size_t required = entities.size() + additional;
+		if (required > entities.capacity()) {
+			entities.reserve(std::max(entities.capacity() * 2, required));
+		}
+		_hierarchy.reserve(additional);
+	}
 
-		registries.push(this);
-		while (!registries.empty()) {
-			EntityRegistry *registry = registries.front();
-			registries.pop();
+	bool EntityRegistry::destroyEntity(
+		const Entity::Identifier &entityIdentifier,
+		ComponentRegistry &componentRegistry)
+	{
+		const auto node = _hierarchy.find(entityIdentifier);
+		if (node == EntityHierarchy::InvalidNode) {
+			return false;
+		}
+		Entity *entity = &_hierarchy.getEntity(node);
+		if (entity->_owner == nullptr) {
+			return false;
+		}
+
+		std::vector<Entity::Identifier> identifiers { entityIdentifier };
+		_hierarchy.forEachDepthFirst(node, [&identifiers](Entity &descendant) {
+			identifiers.push_back(descendant.getIdentifier());
+		});
+		std::sort(identifiers.begin(), identifiers.end());
+		for (EntityRegistry *registry = entity->_owner; registry != nullptr;
+			 registry = registry->_parentRegistry) {
+			registry->unindexSubtree(
+				registry->_hierarchy.find(entityIdentifier), identifiers);
+		}
 
-			for (auto &entity: registry->accessDirectEntities()) {
-				Entity *rawEntity = entity.get();
-				entities.push_back(rawEntity);
+		auto &siblings = entity->_owner->accessDirectEntities();
 
-				auto *childRegistry = dynamic_cast<EntityRegistry *>(rawEntity);
-				if (childRegistry != nullptr) {
-					registries.push(childRegistry);
-				}
-			}
+		const auto iterator = std::find_if(
+			siblings.begin(), siblings.end(),
+			[entity](const auto &sibling) { return sibling.get() == entity; });
+		const std::unique_ptr<Entity> destroyed = std::move(*iterator);
+		siblings.erase(iterator);
+
+		// Free the components before the identifiers can be reused.
+		for (const auto &identifier: identifiers) {
+			componentRegistry.destroyEntity(identifier);
 		}
+		return true;
+	}
+
+	const EntityHierarchy &EntityRegistry::getHierarchy(void) const
+	{
+		return _hierarchy;
+	}
+
+	std::size_t EntityRegistry::getEntityCount(void) const
+	{
+		return _hierarchy.size();
+	}
 
+	std::vector<Entity *> EntityRegistry::getEntitiesBreadthFirst(void)
+	{
+		std::vector<Entity *> entities;
+		entities.reserve(_hierarchy.size());
+		_hierarchy.forEachBreadthFirst(
+			[&entities](Entity &entity) { entities.push_back(&entity); });
 		return entities;
 	}
 
@@ -58,25 +167,9 @@ namespace guillaume::ecs
 		EntityRegistry::getEntitiesBreadthFirst(void) const
 	{
 		std::vector<const Entity *> entities;
-		std::queue<const EntityRegistry *> registries;
-
-		registries.push(this);
-		while (!registries.empty()) {
-			const EntityRegistry *registry = registries.front();
-			registries.pop();
-
-			for (const auto &entity: registry->accessDirectEntities()) {
-				const Entity *rawEntity = entity.get();
-				entities.push_back(rawEntity);
-
-				auto *childRegistry =
-					dynamic_cast<const EntityRegistry *>(rawEntity);
-				if (childRegistry != nullptr) {
-					registries.push(childRegistry);
-				}
-			}
-		}
-
+		entities.reserve(_hierarchy.size());
+		_hierarchy.forEachBreadthFirst(
+			[&entities](const Entity &entity) { entities.push_back(&entity); });
 		return entities;
 	}
 
@@ -84,13 +177,44 @@ namespace guillaume::ecs
 		Entity::Signature systemSignature) const
 	{
 		std::vector<Entity::Identifier> matchingIdentifiers;
-		for (const auto *entity: getEntitiesBreadthFirst()) {
-			if ((entity->getSignature() & systemSignature) == systemSignature) {
-				matchingIdentifiers.push_back(entity->getIdentifier());
+		_hierarchy.forEachBreadthFirst([&](const Entity &entity) {
+			if ((entity.getSignature() & systemSignature) == systemSignature) {
+				matchingIdentifiers.push_back(entity.getIdentifier());
 			}
-		}
+		});
 
 		return matchingIdentifiers;
 	}
 
+	const EntityQuery &EntityRegistry::getQuery(Entity::Signature signature)
+	{
+		for (const auto &query: _queries) {
+			if (query->getSignature() == signature) {
+				return *query;
+			}
+		}
+
+		_queries.push_back(std::make_unique<EntityQuery>(signature));
+		fillQuery(*_queries.back());
+		return *_queries.back();
+	}
+
+	void EntityRegistry::fillQuery(EntityQuery &query) const
+	{
+		query.clear();
+		_hierarchy.forEachBreadthFirst([this, &query](const Entity &entity) {
+			query.insert(entity, _hierarchy);
+		});
+	}
+
+	Entity *EntityRegistry::findEntity(
+		const Entity::Identifier &entityIdentifier) const
+	{
+		const auto node = _hierarchy.find(entityIdentifier);
+		if (node == EntityHierarchy::InvalidNode) {
+			return nullptr;
+		}
+		return &_hierarchy.getEntity(node);
+	}
+
 }	 // namespace guillaume::ecs
@@ -22,6 +22,8 @@
 
 #include "guillaume/ecs/system.hpp"
 
+#include <algorithm>
+
 namespace guillaume::ecs
 {
 	System::System(Phase phase)
@@ -59,42 +61,155 @@ namespace guillaume::ecs
 		return _signature;
 	}
 
-	void System::routine(ecs::ComponentRegistry &componentRegistry,
-						 ecs::EntityRegistry &entityRegistry)
+	Entity::Signature System::getWriteSignature(void) const
 	{
-		_activeComponentRegistry = &componentRegistry;
-		getLogger().debug("System routine started");
-
-		bool hasPendingChanges = false;
-		std::size_t visitedEntities = 0;
-		for (auto *entity: entityRegistry.getEntitiesBreadthFirst()) {
-			++visitedEntities;
-			if (!componentRegistry.hasChanged(entity->getIdentifier())) {
-				continue;
+		return _writeSignature;
+	}
+
+	Entity::Signature System::getReadSignature(void) const
+	{
+		return _signature & ~_writeSignature;
+	}
+
+	bool System::isExclusive(void) const
+	{
+		return _isExclusive;
+	}
+
+	bool System::conflictsWith(const System &other) const
+	{
+		if (_isExclusive || other._isExclusive) {
+			return true;
+		}
+		return (_writeSignature & other._signature).any()
+			|| (other._writeSignature & _signature).any();
+	}
+
+	void System::setAccess(const Entity::Signature &signature,
+						   const Entity::Signature &writeSignature)
+	{
+		_signature		= signature;
+		_writeSignature = writeSignature & signature;
+	}
+
+	void System::setExclusive(bool isExclusive)
+	{
+		_isExclusive = isExclusive;
+	}
+
+	void System::applyPendingChanges(ecs::ComponentRegistry &componentRegistry,
+									 ecs::EntityRegistry &entityRegistry)
+	{
+		const auto &pendingChanges = componentRegistry.getPendingChanges();
+		if (pendingChanges.empty()) {
+			return;
+		}
+
+		// Update parents before their children, as a breadth-first walk
+		// would, so that a child written by its parent's update is updated
+		// afterwards. Updates may change components, which appends to the
+		// pending changes: those are handled in a following round.
+		static thread_local std::vector<EntityHierarchy::Node> nodes;
+		const auto &hierarchy = entityRegistry.getHierarchy();
+		std::size_t handled	  = 0;
+		while (handled < pendingChanges.size()) {
+			nodes.clear();
+			for (; handled < pendingChanges.size(); ++handled) {
+				const auto node = hierarchy.find(pendingChanges[handled]);
+				if (node != EntityHierarchy::InvalidNode) {
+					nodes.push_back(node);
+				}
+			}
+			std::sort(nodes.begin(), nodes.end(),
+					  [&hierarchy](const auto &first, const auto &second) {
+						  return hierarchy.isBreadthFirstBefore(first, second);
+					  });
+			for (const auto &node: nodes) {
+				hierarchy.getEntity(node).update();
 			}
-			hasPendingChanges = true;
-			entity->update();
 		}
+		componentRegistry.resetChangedFlags();
+	}
 
-		if (hasPendingChanges) {
-			componentRegistry.resetChangedFlags();
-			getLogger().debug("System routine applied pending component "
-							  "changes");
+	void System::prepareStorages(ecs::ComponentRegistry &)
+	{
+	}
+
+	void System::bindStorages(ecs::ComponentRegistry &)
+	{
+	}
+
+	void System::run(ecs::ComponentRegistry &componentRegistry,
+					 const EntityQuery &query)
+	{
+		_activeComponentRegistry = &componentRegistry;
+		bindStorages(componentRegistry);
+		logging::debug(getLogger(), [] { return "System run started"; });
+
+		updateQuery(query);
+
+		logging::debug(getLogger(), [&query] {
+			return "System run finished. Matching entities: "
+				+ std::to_string(query.size());
+		});
+
+		_activeComponentRegistry = nullptr;
+	}
+
+	void System::parallelFor(std::size_t count, std::size_t chunkSize,
+							 const ThreadPool::RangeBody &body)
+	{
+		if (_threadPool == nullptr) {
+			body(0, count);
+			return;
 		}
+		_threadPool->parallelForChunks(count, chunkSize, body);
+	}
 
-		std::size_t matchingEntities = 0;
-		for (const auto &entityIdentifier:
-			 entityRegistry.getEntityWithSignature(getSignature())) {
-			++matchingEntities;
+	void System::setThreadPool(ThreadPool *threadPool)
+	{
+		_threadPool = threadPool;
+	}
+
+	void System::updateBatch(std::span<const Entity::Identifier> entities)
+	{
+		for (const auto &entityIdentifier: entities) {
 			update(entityIdentifier);
 		}
+	}
+
+	void System::updateQuery(const EntityQuery &query)
+	{
+		// Update a snapshot of the query: updates may add entities, which
+		// inserts them into the query and may reallocate it.
+		std::size_t insertionCount = query.getInsertionCount();
+		_batch.assign(query.getIdentifiers().begin(),
+					  query.getIdentifiers().end());
+		updateBatch(_batch);
+		if (query.getInsertionCount() == insertionCount) {
+			return;
+		}
 
-		getLogger().debug("System routine finished. Visited entities: "
-						  + std::to_string(visitedEntities)
-						  + ", matching entities: "
-						  + std::to_string(matchingEntities));
+		// Added entities can sit anywhere in the query: update those missing
+		// from the entities already updated.
+		_updatedEntities.assign(_batch.begin(), _batch.end());
+		std::sort(_updatedEntities.begin(), _updatedEntities.end());
+		while (query.getInsertionCount() != insertionCount) {
+			insertionCount = query.getInsertionCount();
+			_batch.clear();
+			query.collectMissing(_updatedEntities, _batch);
+			_updatedEntities.insert(_updatedEntities.end(), _batch.begin(),
+									_batch.end());
+			std::sort(_updatedEntities.begin(), _updatedEntities.end());
+			updateBatch(_batch);
+		}
+	}
 
-		_activeComponentRegistry = nullptr;
+	void System::routine(ecs::ComponentRegistry &componentRegistry,
+						 ecs::EntityRegistry &entityRegistry)
+	{
+		applyPendingChanges(componentRegistry, entityRegistry);
+		run(componentRegistry, entityRegistry.getQuery(getSignature()));
 	}
 
 }	 // namespace guillaume::ecs
\ No newline at end of file
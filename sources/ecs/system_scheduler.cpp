@@ -0,0 +1,113 @@
+/*
+ Copyright (c) 2026 ETIB Corporation
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy of
+ this software and associated documentation files (the "Software"), to deal in
+ the Software without restriction, including without limitation the rights to
+ use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ of the Software, and to permit persons to whom the Software is furnished to do
+ so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in all
+ copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ SOFTWARE.
+ */
+
+#include "guillaume/ecs/system_scheduler.hpp"
+
+#include <algorithm>
+#include <string>
+
+#include "guillaume/logging.hpp"
+
+namespace guillaume::ecs
+{
+
+	SystemScheduler::SystemScheduler(const SystemRegistry &systemRegistry,
+									 ThreadPool &threadPool)
+		: _systemRegistry(systemRegistry)
+		, _threadPool(threadPool)
+	{
+	}
+
+	std::vector<SystemScheduler::Wave> SystemScheduler::buildWaves(
+		const std::vector<std::unique_ptr<System>> &systems)
+	{
+		std::vector<Wave> waves;
+		std::vector<std::size_t> systemWaves(systems.size(), 0);
+
+		for (std::size_t index = 0; index < systems.size(); ++index) {
+			std::size_t wave = 0;
+			for (std::size_t dependency = 0; dependency < index;
+				 ++dependency) {
+				if (systems[index]->conflictsWith(*systems[dependency])) {
+					wave = std::max(wave, systemWaves[dependency] + 1);
+				}
+			}
+			systemWaves[index] = wave;
+			if (wave >= waves.size()) {
+				waves.resize(wave + 1);
+			}
+			waves[wave].push_back(systems[index].get());
+		}
+
+		return waves;
+	}
+
+	const std::vector<SystemScheduler::Wave> &
+		SystemScheduler::getWaves(System::Phase phase)
+	{
+		const auto &systems = _systemRegistry.getSystemsByPhase(phase);
+		auto &schedule		= _schedules[phase];
+		if (schedule.systemCount != systems.size()
+			|| schedule.waves.empty()) {
+			schedule.waves		 = buildWaves(systems);
+			schedule.systemCount = systems.size();
+			for (const auto &system: systems) {
+				system->setThreadPool(&_threadPool);
+			}
+			logging::debug(getLogger(), [&schedule, phase] {
+				return "Scheduled " + std::to_string(schedule.systemCount)
+					+ " systems in " + std::to_string(schedule.waves.size())
+					+ " waves for phase "
+					+ std::to_string(static_cast<int>(phase));
+			});
+		}
+		return schedule.waves;
+	}
+
+	void SystemScheduler::run(System::Phase phase,
+							  ComponentRegistry &componentRegistry,
+							  EntityRegistry &entityRegistry)
+	{
+		for (const auto &wave: getWaves(phase)) {
+			if (wave.size() == 1) {
+				wave.front()->routine(componentRegistry, entityRegistry);
+				continue;
+			}
+
+			// Everything that may mutate shared registry state happens here,
+			// before the systems of the wave run concurrently.
+			System::applyPendingChanges(componentRegistry, entityRegistry);
+			_queries.clear();
+			for (auto *system: wave) {
+				system->prepareStorages(componentRegistry);
+				_queries.push_back(
+					&entityRegistry.getQuery(system->getSignature()));
+			}
+
+			_threadPool.parallelFor(
+				wave.size(), [&](std::size_t index) {
+					wave[index]->run(componentRegistry, *_queries[index]);
+				});
+		}
+	}
+
+}	 // namespace guillaume::ecs
@@ -0,0 +1,188 @@
+/*
+ Copyright (c) 2026 ETIB Corporation
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy of
+ this software and associated documentation files (the "Software"), to deal in
+ the Software without restriction, including without limitation the rights to
+ use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ of the Software, and to permit persons to whom the Software is furnished to do
+ so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in all
+ copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ SOFTWARE.
+ */
+
+#include "guillaume/ecs/thread_pool.hpp"
+
+#include <algorithm>
+
+namespace guillaume::ecs
+{
+
+	std::size_t ThreadPool::getDefaultWorkerCount(void)
+	{
+		const std::size_t concurrency = std::thread::hardware_concurrency();
+		return concurrency > 1 ? concurrency - 1 : 0;
+	}
+
+	ThreadPool::ThreadPool(std::size_t workerCount)
+	{
+		for (std::size_t index = 0; index < workerCount; ++index) {
+			_queues.push_back(std::make_unique<Queue>());
+		}
+		for (std::size_t index = 0; index < workerCount; ++index) {
+			_workers.emplace_back(&ThreadPool::work, this, index);
+		}
+	}
+
+	ThreadPool::~ThreadPool(void)
+	{
+		{
+			std::lock_guard<std::mutex> lock(_sleepMutex);
+			_isStopping = true;
+		}
+		_wakeUp.notify_all();
+		for (auto &worker: _workers) {
+			worker.join();
+		}
+	}
+
+	std::size_t ThreadPool::getWorkerCount(void) const
+	{
+		return _workers.size();
+	}
+
+	bool ThreadPool::takeJob(std::size_t queueIndex, Job &job)
+	{
+		if (queueIndex < _queues.size()) {
+			Queue &queue = *_queues[queueIndex];
+			std::lock_guard<std::mutex> lock(queue.mutex);
+			if (!queue.jobs.empty()) {
+				job = queue.jobs.back();
+				queue.jobs.pop_back();
+				--_queuedJobs;
+				return true;
+			}
+		}
+
+		for (std::size_t offset = 1; offset <= _queues.size(); ++offset) {
+			Queue &queue = *_queues[(queueIndex + offset) % _queues.size()];
+			std::lock_guard<std::mutex> lock(queue.mutex);
+			if (!queue.jobs.empty()) {
+				job = queue.jobs.front();
+				queue.jobs.pop_front();
+				--_queuedJobs;
+				return true;
+			}
+		}
+		return false;
+	}
+
+	void ThreadPool::execute(const Job &job)
+	{
+		std::exception_ptr exception;
+		try {
+			(*job.body)(job.index);
+		} catch (...) {
+			exception = std::current_exception();
+		}
+
+		std::lock_guard<std::mutex> lock(job.batch->mutex);
+		if (exception && !job.batch->exception) {
+			job.batch->exception = exception;
+		}
+		if (--job.batch->remaining == 0) {
+			job.batch->completed.notify_all();
+		}
+	}
+
+	void ThreadPool::work(std::size_t queueIndex)
+	{
+		Job job;
+		while (true) {
+			if (takeJob(queueIndex, job)) {
+				execute(job);
+				continue;
+			}
+
+			std::unique_lock<std::mutex> lock(_sleepMutex);
+			_wakeUp.wait(lock,
+						 [this] { return _isStopping || _queuedJobs > 0; });
+			if (_isStopping && _queuedJobs == 0) {
+				return;
+			}
+		}
+	}
+
+	void ThreadPool::parallelFor(std::size_t count, const Body &body)
+	{
+		if (count == 0) {
+			return;
+		}
+		if (_workers.empty() || count == 1) {
+			for (std::size_t index = 0; index < count; ++index) {
+				body(index);
+			}
+			return;
+		}
+
+		Batch batch;
+		batch.remaining = count;
+		for (std::size_t index = 0; index < count; ++index) {
+			Queue &queue = *_queues[index % _queues.size()];
+			std::lock_guard<std::mutex> lock(queue.mutex);
+			queue.jobs.push_back({ &body, index, &batch });
+			++_queuedJobs;
+		}
+		{
+			std::lock_guard<std::mutex> lock(_sleepMutex);
+		}
+		_wakeUp.notify_all();
+
+		// Help with the queued jobs instead of blocking, then wait for the
+		// jobs still running on workers.
+		Job job;
+		std::unique_lock<std::mutex> lock(batch.mutex);
+		while (batch.remaining > 0) {
+			lock.unlock();
+			const bool hasJob = takeJob(_queues.size(), job);
+			if (hasJob) {
+				execute(job);
+			}
+			lock.lock();
+			if (!hasJob) {
+				break;
+			}
+		}
+		batch.completed.wait(lock, [&batch] { return batch.remaining == 0; });
+		if (batch.exception) {
+			std::rethrow_exception(batch.exception);
+		}
+	}
+
+	void ThreadPool::parallelForChunks(std::size_t count,
+									   std::size_t chunkSize,
+									   const RangeBody &body)
+	{
+		if (count == 0) {
+			return;
+		}
+		if (chunkSize == 0) {
+			chunkSize = 1;
+		}
+		const std::size_t chunkCount = (count + chunkSize - 1) / chunkSize;
+		parallelFor(chunkCount, [&](std::size_t chunk) {
+			const std::size_t begin = chunk * chunkSize;
+			body(begin, std::min(begin + chunkSize, count));
+		});
+	}
+
+}	 // namespace guillaume::ecs
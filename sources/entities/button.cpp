@@ -722,14 +722,14 @@ namespace guillaume::entities
 
 		getComponentRegistry()
 			.getComponent<components::Interaction>(getIdentifier())
-			.setMouseOnHoverHandler(std::bind(&Button::hoverHandler, this))
-			.setMouseOnUnhoverHandler(std::bind(&Button::unHoverHandler, this))
+			.setMouseOnHoverHandler([this] { hoverHandler(); })
+			.setMouseOnUnhoverHandler([this] { unHoverHandler(); })
 			.setMouseButtonOnClickHandler(
 				utility::event::MouseButtonEvent::Button::Left,
-				std::bind(&Button::leftClickPressHandler, this))
+				[this] { leftClickPressHandler(); })
 			.setMouseButtonOnClickReleaseHandler(
 				utility::event::MouseButtonEvent::Button::Left,
-				std::bind(&Button::leftClickReleaseHandler, this));
+				[this] { leftClickReleaseHandler(); });
 	}
 
 }	 // namespace guillaume::entities
\ No newline at end of file
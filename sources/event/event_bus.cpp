@@ -25,27 +25,103 @@
 namespace guillaume::event
 {
 
-	void EventBus::dispatchToListeners(
-		std::unique_ptr<utility::event::Event> event, ListenerList &listeners)
+	void EventBus::dispatchToListeners(const EventPointer &event,
+									   ListenerList &listeners)
 	{
-		for (auto &listener: listeners) {
-			if (!listener) {
+		for (auto &subscription: listeners) {
+			if (!subscription.listener) {
 				continue;
 			}
-			listener(std::move(event));
+			subscription.listener(event);
 		}
 	}
 
-	void EventBus::publish(std::unique_ptr<utility::event::Event> event)
+	EventBus::Route &EventBus::getRoute(std::size_t typeId)
 	{
-		auto *rawEvent = event.get();
-		if (!rawEvent) {
+		if (typeId >= _routes.size()) {
+			_routes.resize(typeId + 1);
+		}
+		return _routes[typeId];
+	}
+
+	EventBus::SubscriptionId EventBus::subscribe(std::size_t typeId,
+												 const Listener &listener)
+	{
+		const SubscriptionId id = _nextSubscriptionId++;
+		getRoute(typeId).listeners.push_back({ id, listener });
+		return id;
+	}
+
+	bool EventBus::unsubscribe(SubscriptionId subscription)
+	{
+		for (auto &route: _routes) {
+			const auto removed = std::erase_if(
+				route.listeners, [subscription](const Subscription &listener) {
+					return listener.id == subscription;
+				});
+			if (removed > 0) {
+				return true;
+			}
+		}
+		return false;
+	}
+
+	EventBus::PendingEvents *
+		EventBus::setCoalescingPolicy(std::size_t typeId,
+									  CoalescingPolicy policy)
+	{
+		auto &route = getRoute(typeId);
+		if (policy == CoalescingPolicy::KeepAll) {
+			route.pending.reset();
+			return nullptr;
+		}
+		route.pending		  = std::make_unique<PendingEvents>();
+		route.pending->policy = policy;
+		return route.pending.get();
+	}
+
+	void EventBus::publish(EventPointer event)
+	{
+		if (!event) {
+			return;
+		}
+
+		const std::size_t typeId = EventTypeId::find(typeid(*event));
+		if (typeId >= _routes.size()) {
+			return;
+		}
+		auto &route = _routes[typeId];
+		if (!route.pending) {
+			dispatchToListeners(event, route.listeners);
+			return;
+		}
+		if (route.pending->policy == CoalescingPolicy::LatestWins) {
+			route.pending->latest.push(std::move(event));
 			return;
 		}
+		std::lock_guard<std::mutex> lock(route.pending->mutex);
+		route.pending->accumulate(route.pending->accumulated, *event);
+	}
 
-		auto it = _typedListeners.find(typeid(*rawEvent));
-		if (it != _typedListeners.end()) {
-			dispatchToListeners(std::move(event), it->second);
+	void EventBus::flush(void)
+	{
+		for (auto &route: _routes) {
+			if (!route.pending) {
+				continue;
+			}
+			EventPointer event;
+			if (route.pending->policy == CoalescingPolicy::LatestWins) {
+				EventPointer next;
+				while (route.pending->latest.tryPop(next)) {
+					event = std::move(next);
+				}
+			} else {
+				std::lock_guard<std::mutex> lock(route.pending->mutex);
+				event = std::move(route.pending->accumulated);
+			}
+			if (event) {
+				dispatchToListeners(event, route.listeners);
+			}
 		}
 	}
 
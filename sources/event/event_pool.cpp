@@ -0,0 +1,110 @@
+/*
+ Copyright (c) 2026 ETIB Corporation
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy of
+ this software and associated documentation files (the "Software"), to deal in
+ the Software without restriction, including without limitation the rights to
+ use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ of the Software, and to permit persons to whom the Software is furnished to do
+ so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in all
+ copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ SOFTWARE.
+ */
+
+#include "guillaume/event/event_pool.hpp"
+
+#include <new>
+
+namespace guillaume::event
+{
+
+	EventPool::~EventPool(void)
+	{
+		for (auto &slot: _freeChunks) {
+			auto *freeChunks = slot.load(std::memory_order_acquire);
+			if (freeChunks == nullptr) {
+				continue;
+			}
+			void *chunk = nullptr;
+			while (freeChunks->tryPop(chunk)) {
+				::operator delete(chunk);
+			}
+			delete freeChunks;
+		}
+	}
+
+	EventPool &EventPool::getInstance(void)
+	{
+		// Never destroyed, so events outliving static destruction can
+		// still be released.
+		static auto *pool = new EventPool();
+		return *pool;
+	}
+
+	EventPool::FreeChunks &EventPool::getFreeChunks(std::size_t size)
+	{
+		const std::size_t index = size == 0 ? 0 : (size - 1) / Granularity;
+		auto &slot				= _freeChunks[index];
+		auto *freeChunks = slot.load(std::memory_order_acquire);
+		if (freeChunks != nullptr) {
+			return *freeChunks;
+		}
+
+		// Racing threads may both create the list; the loser drops its own.
+		auto created = std::make_unique<FreeChunks>(
+			FreeChunksPerSize, OverflowPolicy::DropNewest);
+		if (slot.compare_exchange_strong(freeChunks, created.get(),
+										 std::memory_order_acq_rel)) {
+			freeChunks = created.release();
+		}
+		return *freeChunks;
+	}
+
+	void *EventPool::allocate(std::size_t size)
+	{
+		if (size > MaxPooledSize) {
+			return ::operator new(size);
+		}
+
+		void *chunk = nullptr;
+		if (getFreeChunks(size).tryPop(chunk)) {
+			return chunk;
+		}
+		const std::size_t granules =
+			size == 0 ? 1 : (size + Granularity - 1) / Granularity;
+		chunk = ::operator new(granules * Granularity);
+		_chunkCount.fetch_add(1, std::memory_order_relaxed);
+		return chunk;
+	}
+
+	void EventPool::deallocate(void *pointer, std::size_t size)
+	{
+		if (pointer == nullptr) {
+			return;
+		}
+		if (size > MaxPooledSize) {
+			::operator delete(pointer);
+			return;
+		}
+
+		if (!getFreeChunks(size).tryPush(std::move(pointer))) {
+			::operator delete(pointer);
+			_chunkCount.fetch_sub(1, std::memory_order_relaxed);
+		}
+	}
+
+	std::size_t EventPool::getChunkCount(void) const
+	{
+		return _chunkCount.load(std::memory_order_relaxed);
+	}
+
+}	 // namespace guillaume::event
@@ -0,0 +1,142 @@
+/*
+ Copyright (c) 2026 ETIB Corporation
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy of
+ this software and associated documentation files (the "Software"), to deal in
+ the Software without restriction, including without limitation the rights to
+ use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ of the Software, and to permit persons to whom the Software is furnished to do
+ so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in all
+ copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ SOFTWARE.
+ */
+
+#include "guillaume/event/event_type_id.hpp"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <unordered_map>
+
+namespace guillaume::event
+{
+	EventTypeLimitExceededException::EventTypeLimitExceededException(void)
+		: _message("Exceeded maximum number of event types")
+	{
+	}
+
+	const char *EventTypeLimitExceededException::what(void) const noexcept
+	{
+		return _message.c_str();
+	}
+
+	namespace
+	{
+
+		/**
+		 * @brief Type of each id handed out so far.
+		 */
+		struct RegisteredTypes {
+			std::atomic<std::size_t> count { 0 };	 ///< Ids handed out
+			std::array<std::atomic<const std::type_info *>, MaxEventTypes>
+				types {};	 ///< Type of each id, null until set
+		};
+
+		RegisteredTypes &getRegisteredTypes(void)
+		{
+			static RegisteredTypes types;
+			return types;
+		}
+
+		/**
+		 * @brief Results of earlier lookups on the calling thread.
+		 */
+		struct LookupCache {
+			std::size_t count { 0 };	///< Id count misses were cached at
+			std::unordered_map<const std::type_info *, std::size_t>
+				ids;	///< Id of each looked up type, or InvalidId
+		};
+
+		/**
+		 * @brief Search the registered types for a type.
+		 * @param type The type to find.
+		 * @param count The number of ids handed out.
+		 * @param isComplete Set to false if an id was handed out but its
+		 * type not stored yet.
+		 * @return The id, or EventTypeId::InvalidId.
+		 */
+		std::size_t scanRegisteredTypes(const std::type_info &type,
+										std::size_t count,
+										bool &isComplete)
+		{
+			auto &registered = getRegisteredTypes();
+			for (std::size_t id = 0; id < count; ++id) {
+				if (registered.types[id].load(std::memory_order_acquire)
+					== &type) {
+					return id;
+				}
+			}
+			// The same type may have several type_info objects across shared
+			// libraries.
+			for (std::size_t id = 0; id < count; ++id) {
+				const auto *candidate =
+					registered.types[id].load(std::memory_order_acquire);
+				if (candidate == nullptr) {
+					isComplete = false;
+				} else if (*candidate == type) {
+					return id;
+				}
+			}
+			return EventTypeId::InvalidId;
+		}
+
+	}	 // namespace
+
+	std::size_t EventTypeId::find(const std::type_info &type)
+	{
+		const std::size_t count =
+			std::min(getRegisteredTypes().count.load(std::memory_order_acquire),
+					 MaxEventTypes);
+
+		// Ids never change once found, but a type missing so far may be
+		// registered later: forget misses whenever new ids were handed out.
+		thread_local LookupCache cache;
+		if (cache.count != count) {
+			std::erase_if(cache.ids, [](const auto &entry) {
+				return entry.second == InvalidId;
+			});
+			cache.count = count;
+		}
+		const auto cached = cache.ids.find(&type);
+		if (cached != cache.ids.end()) {
+			return cached->second;
+		}
+
+		bool isComplete		 = true;
+		const std::size_t id = scanRegisteredTypes(type, count, isComplete);
+		if (id != InvalidId || isComplete) {
+			cache.ids.emplace(&type, id);
+		}
+		return id;
+	}
+
+	std::size_t EventTypeId::registerType(const std::type_info &type)
+	{
+		auto &registered	 = getRegisteredTypes();
+		const std::size_t id = registered.count.fetch_add(1);
+		if (id >= MaxEventTypes) {
+			throw EventTypeLimitExceededException();
+		}
+		registered.types[id].store(&type, std::memory_order_release);
+		return id;
+	}
+}	 // namespace guillaume::event
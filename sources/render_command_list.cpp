@@ -0,0 +1,68 @@
+/*
+ Copyright (c) 2026 ETIB Corporation
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy of
+ this software and associated documentation files (the "Software"), to deal in
+ the Software without restriction, including without limitation the rights to
+ use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ of the Software, and to permit persons to whom the Software is furnished to do
+ so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in all
+ copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ SOFTWARE.
+ */
+
+#include "guillaume/render_command_list.hpp"
+
+namespace guillaume
+{
+
+	void RenderCommandList::appendTriangleFan(
+		std::span<const utility::graphic::VertexF> fan)
+	{
+		if (fan.size() < 3) {
+			return;
+		}
+
+		const auto anchor = static_cast<Index>(_vertices.size());
+		_vertices.insert(_vertices.end(), fan.begin(), fan.end());
+		_indices.reserve(_indices.size() + ((fan.size() - 2) * 3));
+		for (Index vertex = 1; vertex + 1 < fan.size(); ++vertex) {
+			_indices.push_back(anchor);
+			_indices.push_back(anchor + vertex);
+			_indices.push_back(anchor + vertex + 1);
+		}
+	}
+
+	const std::vector<utility::graphic::VertexF> &
+		RenderCommandList::getVertices(void) const
+	{
+		return _vertices;
+	}
+
+	const std::vector<RenderCommandList::Index> &
+		RenderCommandList::getIndices(void) const
+	{
+		return _indices;
+	}
+
+	bool RenderCommandList::empty(void) const
+	{
+		return _indices.empty();
+	}
+
+	void RenderCommandList::clear(void)
+	{
+		_vertices.clear();
+		_indices.clear();
+	}
+
+}	 // namespace guillaume
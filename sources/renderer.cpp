@@ -24,4 +24,68 @@
 
 namespace guillaume
 {
+
+	void Renderer::drawTriangles(
+		std::span<const utility::graphic::VertexF> vertices,
+		std::span<const RenderCommandList::Index> indices)
+	{
+		// Rebuild the fans split by RenderCommandList::appendTriangleFan():
+		// consecutive triangles (a, b, c), (a, c, d) belong to the same fan.
+		std::size_t index = 0;
+		while (index + 2 < indices.size()) {
+			const auto anchor = indices[index];
+			_fanVertices.clear();
+			_fanVertices.push_back(vertices[anchor]);
+			_fanVertices.push_back(vertices[indices[index + 1]]);
+			_fanVertices.push_back(vertices[indices[index + 2]]);
+			index += 3;
+			while (index + 2 < indices.size() && indices[index] == anchor
+				   && indices[index + 1] == indices[index - 1]) {
+				_fanVertices.push_back(vertices[indices[index + 2]]);
+				index += 3;
+			}
+			drawVertices(_fanVertices);
+			++_frameStatistics.drawCalls;
+		}
+	}
+
+	RenderCommandList &Renderer::getCommandList(void)
+	{
+		return _commandList;
+	}
+
+	void Renderer::flush(void)
+	{
+		if (_commandList.empty()) {
+			return;
+		}
+		// The default drawTriangles() counts the drawVertices() calls it
+		// makes; an override submits the list as one batch.
+		const std::size_t drawCalls = _frameStatistics.drawCalls;
+		drawTriangles(_commandList.getVertices(), _commandList.getIndices());
+		if (_frameStatistics.drawCalls == drawCalls) {
+			++_frameStatistics.drawCalls;
+		}
+		_frameStatistics.vertices += _commandList.getIndices().size();
+		_commandList.clear();
+	}
+
+	void Renderer::beginFrame(void)
+	{
+		_commandList.clear();
+		_frameStatistics = FrameStatistics();
+	}
+
+	void Renderer::endFrame(void)
+	{
+		flush();
+		_lastFrameStatistics = _frameStatistics;
+	}
+
+	const Renderer::FrameStatistics &
+		Renderer::getFrameStatistics(void) const
+	{
+		return _lastFrameStatistics;
+	}
+
 }	 // namespace guillaume
\ No newline at end of file
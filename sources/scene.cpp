@@ -51,7 +51,7 @@ namespace guillaume
 	{
 		getLogger().info(
 			"Scene destroyed with "
-			+ std::to_string(getEntitiesBreadthFirst().size())
+			+ std::to_string(getEntityCount())
 			+ " entity/entities in hierarchy");
 	}
 
@@ -75,4 +75,9 @@ namespace guillaume
 		return *this;
 	}
 
+	ecs::CommandBuffer &Scene::getCommandBuffer(void)
+	{
+		return _commandBuffer;
+	}
+
 }	 // namespace guillaume
\ No newline at end of file
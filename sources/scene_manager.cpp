@@ -64,4 +64,9 @@ namespace guillaume
 		return getActiveScene()->getComponentRegistry();
 	}
 
+	ecs::CommandBuffer &SceneManager::getActiveCommandBuffer(void)
+	{
+		return getActiveScene()->getCommandBuffer();
+	}
+
 }	 // namespace guillaume
\ No newline at end of file
@@ -0,0 +1,316 @@
+/*
+ Copyright (c) 2026 ETIB Corporation
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy of
+ this software and associated documentation files (the "Software"), to deal in
+ the Software without restriction, including without limitation the rights to
+ use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ of the Software, and to permit persons to whom the Software is furnished to do
+ so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in all
+ copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ SOFTWARE.
+ */
+
+#include "guillaume/spatial/bounding_volume_hierarchy.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace guillaume::spatial
+{
+
+	BoundingVolumeHierarchy::Bounds3D
+		BoundingVolumeHierarchy::getBounds(const OrientedRectangle &rectangle)
+	{
+		Bounds3D bounds;
+		const auto &center = rectangle.getCenter();
+		const auto &axisX  = rectangle.getAxisX();
+		const auto &axisY  = rectangle.getAxisY();
+		for (std::size_t axis = 0; axis < 3; ++axis) {
+			const float extent =
+				(std::abs(axisX[axis]) * rectangle.getHalfWidth())
+				+ (std::abs(axisY[axis]) * rectangle.getHalfHeight());
+			bounds.minimum[axis] = center[axis] - extent;
+			bounds.maximum[axis] = center[axis] + extent;
+		}
+		return bounds;
+	}
+
+	BoundingVolumeHierarchy::Bounds3D
+		BoundingVolumeHierarchy::computeNodeBounds(const Node &node) const
+	{
+		constexpr float infinity = std::numeric_limits<float>::infinity();
+		Bounds3D bounds { { infinity, infinity, infinity },
+						  { -infinity, -infinity, -infinity } };
+		const auto merge = [&bounds](const Bounds3D &other) {
+			for (std::size_t axis = 0; axis < 3; ++axis) {
+				bounds.minimum[axis] =
+					std::min(bounds.minimum[axis], other.minimum[axis]);
+				bounds.maximum[axis] =
+					std::max(bounds.maximum[axis], other.maximum[axis]);
+			}
+		};
+
+		if (node.count == 0) {
+			merge(_nodes[node.first].bounds);
+			merge(_nodes[node.first + 1].bounds);
+			return bounds;
+		}
+		for (std::uint32_t entry = node.first; entry < node.first + node.count;
+			 ++entry) {
+			merge(_items[_order[entry]].bounds);
+		}
+		return bounds;
+	}
+
+	void BoundingVolumeHierarchy::build(std::uint32_t nodeIndex,
+										std::uint32_t parent,
+										std::size_t begin, std::size_t end)
+	{
+		_nodes[nodeIndex].parent = parent;
+		_nodes[nodeIndex].first	 = static_cast<std::uint32_t>(begin);
+		_nodes[nodeIndex].count	 = static_cast<std::uint32_t>(end - begin);
+		_nodes[nodeIndex].bounds = computeNodeBounds(_nodes[nodeIndex]);
+		if (end - begin <= MaxLeafSize) {
+			for (std::size_t entry = begin; entry < end; ++entry) {
+				_leaves[_order[entry]] = nodeIndex;
+			}
+			return;
+		}
+
+		// Split at the median center along the widest axis.
+		const auto &bounds = _nodes[nodeIndex].bounds;
+		std::size_t axis   = 0;
+		for (std::size_t candidate = 1; candidate < 3; ++candidate) {
+			if (bounds.maximum[candidate] - bounds.minimum[candidate]
+				> bounds.maximum[axis] - bounds.minimum[axis]) {
+				axis = candidate;
+			}
+		}
+		const auto middle = begin + ((end - begin) / 2);
+		std::nth_element(
+			_order.begin() + static_cast<std::ptrdiff_t>(begin),
+			_order.begin() + static_cast<std::ptrdiff_t>(middle),
+			_order.begin() + static_cast<std::ptrdiff_t>(end),
+			[this, axis](std::uint32_t left, std::uint32_t right) {
+				return _items[left].rectangle.getCenter()[axis]
+					< _items[right].rectangle.getCenter()[axis];
+			});
+
+		const auto left = static_cast<std::uint32_t>(_nodes.size());
+		_nodes.resize(_nodes.size() + 2);
+		_nodes[nodeIndex].first = left;
+		_nodes[nodeIndex].count = 0;
+		build(left, nodeIndex, begin, middle);
+		build(left + 1, nodeIndex, middle, end);
+	}
+
+	void BoundingVolumeHierarchy::refresh(void)
+	{
+		if (_needsRebuild) {
+			_needsRebuild = false;
+			_moved.clear();
+			_nodes.clear();
+			_order.resize(_items.size());
+			_leaves.resize(_items.size());
+			for (std::size_t item = 0; item < _items.size(); ++item) {
+				_order[item] = static_cast<std::uint32_t>(item);
+			}
+			if (_items.empty()) {
+				return;
+			}
+			_nodes.reserve((2 * _items.size()) / MaxLeafSize + 1);
+			_nodes.resize(1);
+			build(0, 0, 0, _items.size());
+			return;
+		}
+
+		for (const auto item: _moved) {
+			auto nodeIndex = _leaves[item];
+			while (true) {
+				_nodes[nodeIndex].bounds = computeNodeBounds(_nodes[nodeIndex]);
+				if (nodeIndex == 0) {
+					break;
+				}
+				nodeIndex = _nodes[nodeIndex].parent;
+			}
+		}
+		_moved.clear();
+	}
+
+	void BoundingVolumeHierarchy::insert(const Identifier &identifier,
+										 const OrientedRectangle &rectangle)
+	{
+		const auto slot = _slots.find(identifier);
+		if (slot == _slots.end()) {
+			_slots.emplace(identifier, _items.size());
+			_items.push_back({ identifier, rectangle, getBounds(rectangle) });
+			_needsRebuild = true;
+			return;
+		}
+		auto &item	   = _items[slot->second];
+		item.rectangle = rectangle;
+		item.bounds	   = getBounds(rectangle);
+		if (!_needsRebuild) {
+			_moved.push_back(static_cast<std::uint32_t>(slot->second));
+		}
+	}
+
+	bool BoundingVolumeHierarchy::remove(const Identifier &identifier)
+	{
+		const auto slot = _slots.find(identifier);
+		if (slot == _slots.end()) {
+			return false;
+		}
+		const auto index = slot->second;
+		_slots.erase(slot);
+		if (index + 1 != _items.size()) {
+			_items[index]					 = std::move(_items.back());
+			_slots[_items[index].identifier] = index;
+		}
+		_items.pop_back();
+		_needsRebuild = true;
+		return true;
+	}
+
+	void BoundingVolumeHierarchy::clear(void)
+	{
+		_items.clear();
+		_slots.clear();
+		_nodes.clear();
+		_order.clear();
+		_leaves.clear();
+		_moved.clear();
+		_needsRebuild = false;
+	}
+
+	bool BoundingVolumeHierarchy::contains(const Identifier &identifier) const
+	{
+		return _slots.contains(identifier);
+	}
+
+	std::size_t BoundingVolumeHierarchy::size(void) const
+	{
+		return _items.size();
+	}
+
+	void BoundingVolumeHierarchy::intersectNearest(
+		std::span<const utility::graphic::RayF> rays,
+		std::span<std::optional<RayHit>> hits)
+	{
+		refresh();
+		for (auto &hit: hits) {
+			hit.reset();
+		}
+		if (_nodes.empty()) {
+			return;
+		}
+
+		for (std::size_t packet = 0; packet < rays.size();
+			 packet += PacketSize) {
+			const auto lanes = std::min(PacketSize, rays.size() - packet);
+
+			// Rays in structure-of-arrays form; unused lanes never hit.
+			std::array<std::array<float, PacketSize>, 3> origins {};
+			std::array<std::array<float, PacketSize>, 3> inverses {};
+			std::array<float, PacketSize> nearest;
+			nearest.fill(-1.0f);
+			std::array<std::uint32_t, PacketSize> nearestItem {};
+			for (std::size_t lane = 0; lane < lanes; ++lane) {
+				const auto origin	 = rays[packet + lane].getOrigin();
+				const auto direction = rays[packet + lane].getDirection();
+				for (std::size_t axis = 0; axis < 3; ++axis) {
+					// Keep zero components finite so slabs never yield NaN.
+					const float component =
+						std::abs(direction[axis]) > 1e-20f
+						? direction[axis]
+						: std::copysign(1e-20f, direction[axis]);
+					origins[axis][lane]	 = origin[axis];
+					inverses[axis][lane] = 1.0f / component;
+				}
+				nearest[lane] = std::numeric_limits<float>::max();
+			}
+
+			std::array<std::uint32_t, 64> stack;
+			std::size_t stackSize = 0;
+			stack[stackSize++]	  = 0;
+			while (stackSize > 0) {
+				const auto &node = _nodes[stack[--stackSize]];
+
+				std::array<float, PacketSize> enter;
+				std::array<float, PacketSize> exit;
+				enter.fill(0.0f);
+				exit = nearest;
+				for (std::size_t axis = 0; axis < 3; ++axis) {
+					for (std::size_t lane = 0; lane < PacketSize; ++lane) {
+						const float toMinimum = (node.bounds.minimum[axis]
+												 - origins[axis][lane])
+							* inverses[axis][lane];
+						const float toMaximum = (node.bounds.maximum[axis]
+												 - origins[axis][lane])
+							* inverses[axis][lane];
+						enter[lane] = std::max(enter[lane],
+											   std::min(toMinimum, toMaximum));
+						exit[lane]	= std::min(exit[lane],
+											   std::max(toMinimum, toMaximum));
+					}
+				}
+				bool isHit = false;
+				for (std::size_t lane = 0; lane < PacketSize; ++lane) {
+					isHit = isHit || enter[lane] <= exit[lane];
+				}
+				if (!isHit) {
+					continue;
+				}
+
+				if (node.count == 0) {
+					stack[stackSize++] = node.first;
+					stack[stackSize++] = node.first + 1;
+					continue;
+				}
+				for (std::uint32_t entry = node.first;
+					 entry < node.first + node.count; ++entry) {
+					const auto &item = _items[_order[entry]];
+					for (std::size_t lane = 0; lane < lanes; ++lane) {
+						float distance = 0.0f;
+						if (enter[lane] <= exit[lane]
+							&& item.rectangle.intersect(rays[packet + lane],
+														nearest[lane],
+														distance)) {
+							nearest[lane]	  = distance;
+							nearestItem[lane] = _order[entry];
+						}
+					}
+				}
+			}
+
+			for (std::size_t lane = 0; lane < lanes; ++lane) {
+				if (nearest[lane] < std::numeric_limits<float>::max()) {
+					hits[packet + lane] = RayHit {
+						_items[nearestItem[lane]].identifier, nearest[lane]
+					};
+				}
+			}
+		}
+	}
+
+	std::optional<RayHit> BoundingVolumeHierarchy::intersectNearest(
+		const utility::graphic::RayF &ray)
+	{
+		std::optional<RayHit> hit;
+		intersectNearest(std::span<const utility::graphic::RayF>(&ray, 1),
+						 std::span<std::optional<RayHit>>(&hit, 1));
+		return hit;
+	}
+
+}	 // namespace guillaume::spatial
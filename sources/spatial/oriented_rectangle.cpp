@@ -0,0 +1,160 @@
+/*
+ Copyright (c) 2026 ETIB Corporation
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy of
+ this software and associated documentation files (the "Software"), to deal in
+ the Software without restriction, including without limitation the rights to
+ use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ of the Software, and to permit persons to whom the Software is furnished to do
+ so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in all
+ copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ SOFTWARE.
+ */
+
+#include "guillaume/spatial/oriented_rectangle.hpp"
+
+#include <cmath>
+
+#include "guillaume/spatial/ray_cast.hpp"
+
+namespace guillaume::spatial
+{
+
+	OrientedRectangle::OrientedRectangle(
+		const utility::graphic::PositionF &center,
+		const utility::graphic::OrientationF &orientation, float width,
+		float height)
+		: _center(center)
+		, _halfWidth(std::abs(width) / 2.0f)
+		, _halfHeight(std::abs(height) / 2.0f)
+	{
+		_axisX =
+			rotate(utility::math::Vector3F({ 1.0f, 0.0f, 0.0f }), orientation);
+		_axisY =
+			rotate(utility::math::Vector3F({ 0.0f, 1.0f, 0.0f }), orientation);
+		_normal =
+			rotate(utility::math::Vector3F({ 0.0f, 0.0f, 1.0f }), orientation);
+	}
+
+	OrientedRectangle
+		OrientedRectangle::fromPose(const utility::graphic::PoseF &pose,
+									float width, float height)
+	{
+		const auto position = pose.getPosition();
+		const utility::graphic::PositionF center(
+			position[0], position[1] - (height / 2.0f), position[2]);
+		return OrientedRectangle(center, pose.getOrientation(), width,
+								 height);
+	}
+
+	const utility::graphic::PositionF &
+		OrientedRectangle::getCenter(void) const
+	{
+		return _center;
+	}
+
+	const utility::math::Vector3F &OrientedRectangle::getAxisX(void) const
+	{
+		return _axisX;
+	}
+
+	const utility::math::Vector3F &OrientedRectangle::getAxisY(void) const
+	{
+		return _axisY;
+	}
+
+	const utility::math::Vector3F &OrientedRectangle::getNormal(void) const
+	{
+		return _normal;
+	}
+
+	float OrientedRectangle::getHalfWidth(void) const
+	{
+		return _halfWidth;
+	}
+
+	float OrientedRectangle::getHalfHeight(void) const
+	{
+		return _halfHeight;
+	}
+
+	Bounds2D OrientedRectangle::getProjectedBounds(void) const
+	{
+		const float extentX = (std::abs(_axisX[0]) * _halfWidth)
+			+ (std::abs(_axisY[0]) * _halfHeight);
+		const float extentY = (std::abs(_axisX[1]) * _halfWidth)
+			+ (std::abs(_axisY[1]) * _halfHeight);
+		return {
+			utility::math::Vector2F(
+				{ _center[0] - extentX, _center[1] - extentY }),
+			utility::math::Vector2F(
+				{ _center[0] + extentX, _center[1] + extentY }),
+		};
+	}
+
+	bool OrientedRectangle::containsProjected(
+		const utility::math::Vector2F &point) const
+	{
+		// Solve point - center = s * axisX + t * axisY in the screen plane.
+		const float offsetX		= point[0] - _center[0];
+		const float offsetY		= point[1] - _center[1];
+		const float determinant = (_axisX[0] * _axisY[1])
+			- (_axisY[0] * _axisX[1]);
+		if (std::abs(determinant) <= 1e-6f) {
+			return false;
+		}
+		const float s =
+			((offsetX * _axisY[1]) - (_axisY[0] * offsetY)) / determinant;
+		const float t =
+			((_axisX[0] * offsetY) - (offsetX * _axisX[1])) / determinant;
+		return std::abs(s) <= _halfWidth && std::abs(t) <= _halfHeight;
+	}
+
+	bool OrientedRectangle::intersect(const utility::graphic::RayF &ray,
+									  float maximumDistance,
+									  float &distance) const
+	{
+		const auto origin	 = ray.getOrigin();
+		const auto direction = ray.getDirection();
+
+		const float approach = (_normal[0] * direction[0])
+			+ (_normal[1] * direction[1]) + (_normal[2] * direction[2]);
+		if (std::abs(approach) <= 1e-6f) {
+			return false;
+		}
+		const float offsetX = _center[0] - origin[0];
+		const float offsetY = _center[1] - origin[1];
+		const float offsetZ = _center[2] - origin[2];
+		const float hitDistance = ((_normal[0] * offsetX)
+								   + (_normal[1] * offsetY)
+								   + (_normal[2] * offsetZ))
+			/ approach;
+		if (hitDistance < 0.0f || hitDistance > maximumDistance) {
+			return false;
+		}
+
+		// Express the hit point in the rectangle's axes.
+		const float localX = (direction[0] * hitDistance) - offsetX;
+		const float localY = (direction[1] * hitDistance) - offsetY;
+		const float localZ = (direction[2] * hitDistance) - offsetZ;
+		const float s = (localX * _axisX[0]) + (localY * _axisX[1])
+			+ (localZ * _axisX[2]);
+		const float t = (localX * _axisY[0]) + (localY * _axisY[1])
+			+ (localZ * _axisY[2]);
+		if (std::abs(s) > _halfWidth || std::abs(t) > _halfHeight) {
+			return false;
+		}
+		distance = hitDistance;
+		return true;
+	}
+
+}	 // namespace guillaume::spatial
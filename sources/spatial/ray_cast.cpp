@@ -0,0 +1,56 @@
+/*
+ Copyright (c) 2026 ETIB Corporation
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy of
+ this software and associated documentation files (the "Software"), to deal in
+ the Software without restriction, including without limitation the rights to
+ use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ of the Software, and to permit persons to whom the Software is furnished to do
+ so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in all
+ copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ SOFTWARE.
+ */
+
+#include "guillaume/spatial/ray_cast.hpp"
+
+namespace guillaume::spatial
+{
+
+	utility::math::Vector3F
+		rotate(const utility::math::Vector3F &vector,
+			   const utility::graphic::OrientationF &orientation)
+	{
+		const auto normalizedOrientation = orientation.normalized();
+		const float qx					 = normalizedOrientation.x;
+		const float qy					 = normalizedOrientation.y;
+		const float qz					 = normalizedOrientation.z;
+		const float qw					 = normalizedOrientation.w;
+
+		const float tX = 2.0f * ((qy * vector[2]) - (qz * vector[1]));
+		const float tY = 2.0f * ((qz * vector[0]) - (qx * vector[2]));
+		const float tZ = 2.0f * ((qx * vector[1]) - (qy * vector[0]));
+
+		return utility::math::Vector3F(
+			{ vector[0] + (qw * tX) + ((qy * tZ) - (qz * tY)),
+			  vector[1] + (qw * tY) + ((qz * tX) - (qx * tZ)),
+			  vector[2] + (qw * tZ) + ((qx * tY) - (qy * tX)) });
+	}
+
+	utility::graphic::RayF makeForwardRay(const utility::graphic::PoseF &pose)
+	{
+		return utility::graphic::RayF(
+			pose.getPosition(),
+			rotate(utility::math::Vector3F({ 0.0f, 0.0f, -1.0f }),
+				   pose.getOrientation()));
+	}
+
+}	 // namespace guillaume::spatial
@@ -0,0 +1,191 @@
+/*
+ Copyright (c) 2026 ETIB Corporation
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy of
+ this software and associated documentation files (the "Software"), to deal in
+ the Software without restriction, including without limitation the rights to
+ use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ of the Software, and to permit persons to whom the Software is furnished to do
+ so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in all
+ copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ SOFTWARE.
+ */
+
+#include "guillaume/spatial/uniform_grid.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace guillaume::spatial
+{
+
+	UniformGrid::UniformGrid(float cellSize)
+		: _cellSize(cellSize > 0.0f ? cellSize : DefaultCellSize)
+	{
+	}
+
+	std::int32_t UniformGrid::getCell(float coordinate) const
+	{
+		constexpr auto limit =
+			static_cast<float>(std::numeric_limits<std::int32_t>::max() / 2);
+		return static_cast<std::int32_t>(
+			std::clamp(std::floor(coordinate / _cellSize), -limit, limit));
+	}
+
+	std::uint64_t UniformGrid::getCellKey(std::int32_t column,
+										  std::int32_t row)
+	{
+		return (static_cast<std::uint64_t>(static_cast<std::uint32_t>(column))
+				<< 32)
+			| static_cast<std::uint32_t>(row);
+	}
+
+	UniformGrid::CellRange
+		UniformGrid::getCells(const OrientedRectangle &rectangle,
+							  bool &isOversized) const
+	{
+		const auto bounds = rectangle.getProjectedBounds();
+		if (!std::isfinite(bounds.minimum[0])
+			|| !std::isfinite(bounds.minimum[1])
+			|| !std::isfinite(bounds.maximum[0])
+			|| !std::isfinite(bounds.maximum[1])) {
+			isOversized = true;
+			return {};
+		}
+
+		const CellRange cells { getCell(bounds.minimum[0]),
+								getCell(bounds.minimum[1]),
+								getCell(bounds.maximum[0]),
+								getCell(bounds.maximum[1]) };
+		const auto columns =
+			static_cast<std::uint64_t>(cells.maximumX - cells.minimumX) + 1;
+		const auto rows =
+			static_cast<std::uint64_t>(cells.maximumY - cells.minimumY) + 1;
+		isOversized = columns * rows > MaxCellsPerRectangle;
+		return isOversized ? CellRange {} : cells;
+	}
+
+	void UniformGrid::link(const Identifier &identifier, const Entry &entry)
+	{
+		if (entry.isOversized) {
+			_oversized.push_back(identifier);
+			return;
+		}
+		for (auto row = entry.cells.minimumY; row <= entry.cells.maximumY;
+			 ++row) {
+			for (auto column = entry.cells.minimumX;
+				 column <= entry.cells.maximumX; ++column) {
+				_cells[getCellKey(column, row)].push_back(identifier);
+			}
+		}
+	}
+
+	void UniformGrid::unlink(const Identifier &identifier, const Entry &entry)
+	{
+		if (entry.isOversized) {
+			std::erase(_oversized, identifier);
+			return;
+		}
+		for (auto row = entry.cells.minimumY; row <= entry.cells.maximumY;
+			 ++row) {
+			for (auto column = entry.cells.minimumX;
+				 column <= entry.cells.maximumX; ++column) {
+				const auto cell = _cells.find(getCellKey(column, row));
+				if (cell == _cells.end()) {
+					continue;
+				}
+				std::erase(cell->second, identifier);
+				if (cell->second.empty()) {
+					_cells.erase(cell);
+				}
+			}
+		}
+	}
+
+	void UniformGrid::insert(const Identifier &identifier,
+							 const OrientedRectangle &rectangle)
+	{
+		Entry entry { rectangle, {}, false };
+		entry.cells = getCells(rectangle, entry.isOversized);
+
+		const auto existing = _entries.find(identifier);
+		if (existing == _entries.end()) {
+			link(identifier, entry);
+			_entries.emplace(identifier, entry);
+			return;
+		}
+		if (existing->second.cells != entry.cells
+			|| existing->second.isOversized != entry.isOversized) {
+			unlink(identifier, existing->second);
+			link(identifier, entry);
+		}
+		existing->second = entry;
+	}
+
+	bool UniformGrid::remove(const Identifier &identifier)
+	{
+		const auto existing = _entries.find(identifier);
+		if (existing == _entries.end()) {
+			return false;
+		}
+		unlink(identifier, existing->second);
+		_entries.erase(existing);
+		return true;
+	}
+
+	void UniformGrid::clear(void)
+	{
+		_entries.clear();
+		_cells.clear();
+		_oversized.clear();
+	}
+
+	bool UniformGrid::contains(const Identifier &identifier) const
+	{
+		return _entries.contains(identifier);
+	}
+
+	std::size_t UniformGrid::size(void) const
+	{
+		return _entries.size();
+	}
+
+	void UniformGrid::queryPoint(const utility::math::Vector2F &point,
+								 std::vector<Identifier> &hits) const
+	{
+		hits.clear();
+		if (!std::isfinite(point[0]) || !std::isfinite(point[1])) {
+			return;
+		}
+		const auto test = [this, &point, &hits](const Identifier &identifier) {
+			const auto entry = _entries.find(identifier);
+			if (entry != _entries.end()
+				&& entry->second.rectangle.containsProjected(point)) {
+				hits.push_back(identifier);
+			}
+		};
+
+		const auto cell =
+			_cells.find(getCellKey(getCell(point[0]), getCell(point[1])));
+		if (cell != _cells.end()) {
+			for (const auto &identifier: cell->second) {
+				test(identifier);
+			}
+		}
+		for (const auto &identifier: _oversized) {
+			test(identifier);
+		}
+		std::sort(hits.begin(), hits.end());
+	}
+
+}	 // namespace guillaume::spatial
@@ -51,14 +51,17 @@ namespace guillaume::systems
 	}
 
 	GlyphRender::GlyphRender(Renderer &renderer)
-		: ecs::SystemFiller<components::Transform, components::Bound,
-							components::Glyph, components::Color>(
+		: ecs::SystemFiller<
+			  ecs::Reads<components::Transform, components::Bound,
+						 components::Glyph, components::Color>>(
 			  ecs::System::Phase::Render)
 		, _renderer(renderer)
 		, _defaultFontPath(
 			  "assets/fonts/Material_Symbols_Outlined/"
 			  "MaterialSymbolsOutlined-VariableFont_FILL,GRAD,opsz,wght.ttf")
 	{
+		// Draw calls go through the shared renderer.
+		setExclusive(true);
 		loadGlyphCodes(
 			"assets/fonts/Material_Symbols_Outlined/"
 			"MaterialSymbolsOutlined[FILL,GRAD,opsz,wght].codepoints");
@@ -70,40 +73,47 @@ namespace guillaume::systems
 
 	void GlyphRender::update(const ecs::Entity::Identifier &entityIdentifier)
 	{
-		getLogger().debug("Updating GlyphRender system for entity "
-						  + std::to_string(entityIdentifier));
-		if (!requireComponent<components::Transform>(entityIdentifier)
-			|| !requireComponent<components::Bound>(entityIdentifier)
-			|| !requireComponent<components::Glyph>(entityIdentifier)
-			|| !requireComponent<components::Color>(entityIdentifier)) {
+		logging::debug(getLogger(), [&entityIdentifier] {
+			return "Updating GlyphRender system for entity "
+				+ std::to_string(entityIdentifier);
+		});
+		const auto *transformComponent =
+			findComponent<components::Transform>(entityIdentifier);
+		const auto *boundComponent =
+			findComponent<components::Bound>(entityIdentifier);
+		const auto *glyphComponent =
+			findComponent<components::Glyph>(entityIdentifier);
+		const auto *colorComponent =
+			findComponent<components::Color>(entityIdentifier);
+		if (transformComponent == nullptr || boundComponent == nullptr
+			|| glyphComponent == nullptr || colorComponent == nullptr) {
+			getLogger().warning(
+				"Entity " + std::to_string(entityIdentifier)
+				+ " is missing a component required by GlyphRender");
 			return;
 		}
 
-		const auto &transformComponent =
-			getComponent<components::Transform>(entityIdentifier);
-		const auto &boundComponent =
-			getComponent<components::Bound>(entityIdentifier);
-		const auto &glyphComponent =
-			getComponent<components::Glyph>(entityIdentifier);
-		const auto &colorComponent =
-			getComponent<components::Color>(entityIdentifier);
+		const std::string glyphName = glyphComponent->getName();
 
-		const std::string glyphName = glyphComponent.getName();
-
-		getLogger().debug("Rendering glyph '" + glyphName + "' for entity "
-						  + std::to_string(entityIdentifier));
-		getLogger().debug("Glyph code found for '" + glyphName
-						  + "': " + std::to_string(glyphComponent.getCode()));
+		logging::debug(getLogger(), [&] {
+			return "Rendering glyph '" + glyphName + "' for entity "
+				+ std::to_string(entityIdentifier);
+		});
+		logging::debug(getLogger(), [&] {
+			return "Glyph code found for '" + glyphName
+				+ "': " + std::to_string(glyphComponent->getCode());
+		});
 
 		const uint32_t glyphCode =
 			_glyphCode.count(glyphName) > 0 ? _glyphCode[glyphName] : '?';
 		utility::graphic::Text glyphText(
 			_renderer.getRessourceManager(), _renderer.getAssetManager(),
-			codePointToUtf8(glyphCode), boundComponent.getHeight(),
+			codePointToUtf8(glyphCode), boundComponent->getHeight(),
 			_defaultFontPath);
-		glyphText.setColor(colorComponent.getColor());
+		glyphText.setColor(colorComponent->getColor());
 
-		_renderer.drawText(glyphText, transformComponent.getPose());
+		_renderer.flush();
+		_renderer.drawText(glyphText, transformComponent->getPose());
 	}
 
 	void GlyphRender::loadGlyphCodes(const std::string &filePath)
@@ -22,6 +22,8 @@
 
 #include "guillaume/systems/interaction.hpp"
 
+#include <algorithm>
+
 #include <utility/graphic/orientation.hpp>
 #include <utility/graphic/position.hpp>
 #include <utility/graphic/ray.hpp>
@@ -45,14 +47,130 @@ namespace guillaume::systems
 			_lastHandMotionEvent =
 				_handMotionSubscriber.getNextEvent();
 		}
+		_hasNewHandPinch = _handPinchSubscriber.hasPendingEvents();
 		while (_handPinchSubscriber.hasPendingEvents()) {
 			_lastHandPinchEvent = _handPinchSubscriber.getNextEvent();
 		}
+		_hasNewHandPoke = _handPokeSubscriber.hasPendingEvents();
 		while (_handPokeSubscriber.hasPendingEvents()) {
 			_lastHandPokeEvent = _handPokeSubscriber.getNextEvent();
 		}
 	}
 
+	bool Interaction::isInteractive(
+		const ecs::Entity::Identifier &entityIdentifier)
+	{
+		return findComponent<components::Interaction>(entityIdentifier)
+				!= nullptr
+			&& findComponent<components::Transform>(entityIdentifier)
+				!= nullptr
+			&& findComponent<components::Bound>(entityIdentifier) != nullptr;
+	}
+
+	void Interaction::indexEntity(
+		const ecs::Entity::Identifier &entityIdentifier)
+	{
+		if (!isInteractive(entityIdentifier)) {
+			_hitGrid.remove(entityIdentifier);
+			_rayIndex.remove(entityIdentifier);
+			return;
+		}
+		const auto *transform =
+			findComponent<components::Transform>(entityIdentifier);
+		const auto *bound = findComponent<components::Bound>(entityIdentifier);
+		const auto rectangle = spatial::OrientedRectangle::fromPose(
+			transform->getPose(), static_cast<float>(bound->getWidth()),
+			static_cast<float>(bound->getHeight()));
+		_hitGrid.insert(entityIdentifier, rectangle);
+		_rayIndex.insert(entityIdentifier, rectangle);
+	}
+
+	void Interaction::updateHitGrid(void)
+	{
+		auto &componentRegistry = getComponentRegistry();
+		const auto frame		= componentRegistry.getFrame();
+
+		if (_indexedRegistry != &componentRegistry || frame < _indexedFrame
+			|| frame - _indexedFrame
+				>= ecs::ComponentRegistry::ChangeHistoryLength) {
+			_hitGrid.clear();
+			_rayIndex.clear();
+			for (const auto &entityIdentifier:
+				 getBoundStorage<components::Interaction>().getIdentifiers()) {
+				indexEntity(entityIdentifier);
+			}
+		} else {
+			// Entries of the current frame may be seen twice; reindexing is
+			// idempotent. New Interaction components are logged as changes.
+			reindexEntries(
+				componentRegistry.getRemovalsSince<components::Interaction>(
+					_indexedFrame));
+			reindexEntries(
+				componentRegistry.getRemovalsSince<components::Transform>(
+					_indexedFrame));
+			reindexEntries(
+				componentRegistry.getRemovalsSince<components::Bound>(
+					_indexedFrame));
+			reindexEntries(
+				componentRegistry.getChangesSince<components::Transform>(
+					_indexedFrame));
+			reindexEntries(
+				componentRegistry.getChangesSince<components::Bound>(
+					_indexedFrame));
+			reindexEntries(
+				componentRegistry.getChangesSince<components::Interaction>(
+					_indexedFrame));
+		}
+
+		_indexedRegistry = &componentRegistry;
+		_indexedFrame	 = frame;
+	}
+
+	void Interaction::reindexEntries(
+		std::span<const ecs::ChangeLog::Entry> entries)
+	{
+		for (const auto &entry: entries) {
+			indexEntity(entry.identifier);
+		}
+	}
+
+	void Interaction::resolveMouseHit(const ecs::EntityQuery &query)
+	{
+		_mouseHit.reset();
+		if (_lastMouseMotionEvent == nullptr) {
+			return;
+		}
+
+		// Entities are drawn at their world position minus the view's.
+		const auto pointer		= _lastMouseMotionEvent->getPosition();
+		const auto viewPosition = _renderer.getView().getPose().getPosition();
+		_hitGrid.queryPoint(
+			utility::math::Vector2F({ pointer[0] + viewPosition[0],
+									  pointer[1] + viewPosition[1] }),
+			_mouseHits);
+
+		// Entities are painted in query order, so the last one is on top.
+		std::size_t topPosition = 0;
+		for (const auto &entityIdentifier: _mouseHits) {
+			const std::size_t position = query.getPosition(entityIdentifier);
+			if (position != ecs::EntityQuery::InvalidPosition
+				&& (!_mouseHit.has_value() || position > topPosition)) {
+				_mouseHit	= entityIdentifier;
+				topPosition = position;
+			}
+		}
+	}
+
+	void Interaction::resolveHandHit(void)
+	{
+		if (_lastHandMotionEvent == nullptr) {
+			_handHit.reset();
+			return;
+		}
+		_handHit = _rayIndex.intersectNearest(
+			spatial::makeForwardRay(_lastHandMotionEvent->getPose()));
+	}
+
 	void Interaction::processMouseHover(
 		const ecs::Entity::Identifier &entityIdentifier, bool isInside)
 	{
@@ -66,6 +184,7 @@ namespace guillaume::systems
 			}
 
 			interaction.setMouseHovered(true);
+			// Copy handlers before calling them: they may replace themselves.
 			const auto onHover = interaction.getMouseOnHoverHandler();
 			if (onHover) {
 				onHover();
@@ -78,8 +197,9 @@ namespace guillaume::systems
 		}
 
 		interaction.setMouseHovered(false);
-		if (interaction.getMouseOnUnhoverHandler()) {
-			interaction.getMouseOnUnhoverHandler()();
+		const auto onUnhover = interaction.getMouseOnUnhoverHandler();
+		if (onUnhover) {
+			onUnhover();
 		}
 	}
 
@@ -93,45 +213,39 @@ namespace guillaume::systems
 		auto &interaction =
 			getComponentRegistry().getComponent<components::Interaction>(
 				entityIdentifier);
+		const auto pressed	 = _lastMouseButtonEvent->getButtonsState();
+		const auto clicked	 = interaction.getMouseButtonsClicked();
+		auto pressing		 = pressed & ~clicked;
+		const auto releasing = clicked & ~pressed;
+		if (!isInside) {
+			pressing.reset();
+		}
+		if (pressing.none() && releasing.none()) {
+			return;
+		}
 
 		for (std::size_t buttonIndex = 0;
-			 buttonIndex < static_cast<std::size_t>(
-				 utility::event::MouseButtonEvent::Button::Last);
+			 buttonIndex < components::Interaction::MouseButtonCount;
 			 ++buttonIndex) {
-			if (!_lastMouseButtonEvent->getButtonsState().test(buttonIndex)) {
-				continue;
-			}
-
 			const auto button =
 				static_cast<utility::event::MouseButtonEvent::Button>(
 					buttonIndex);
-			const bool isPressed =
-				_lastMouseButtonEvent->getButtonsState().test(buttonIndex);
 
-			if (isPressed && isInside) {
+			if (pressing.test(buttonIndex)) {
 				interaction.setMouseButtonClicked(button, true);
-				const auto &onClickHandler =
-					interaction.getMouseButtonOnClickHandlers().at(button);
+				const auto onClickHandler =
+					interaction.getMouseButtonOnClickHandler(button);
 				if (onClickHandler) {
 					onClickHandler();
 				}
-				break;
-			}
-
-			if (!isPressed && interaction.isMouseButtonClicked(button)
-				&& isInside) {
+			} else if (releasing.test(buttonIndex)) {
+				// Releasing outside the entity cancels the click.
 				interaction.setMouseButtonClicked(button, false);
-				const auto &onReleaseHandler =
-					interaction.getMouseButtonOnClickReleaseHandlers().at(
-						button);
-				if (onReleaseHandler) {
+				const auto onReleaseHandler =
+					interaction.getMouseButtonOnClickReleaseHandler(button);
+				if (isInside && onReleaseHandler) {
 					onReleaseHandler();
 				}
-				break;
-			}
-
-			if (!isPressed) {
-				interaction.setMouseButtonClicked(button, false);
 			}
 		}
 	}
@@ -142,6 +256,20 @@ namespace guillaume::systems
 		if (_lastHandMotionEvent == nullptr) {
 			return;
 		}
+
+		auto &interaction =
+			getComponentRegistry().getComponent<components::Interaction>(
+				entityIdentifier);
+		if (interaction.isHandHovered() == isInside) {
+			return;
+		}
+
+		interaction.setHandHovered(isInside);
+		const auto handler = isInside ? interaction.getHandOnHoverHandler()
+									  : interaction.getHandOnUnhoverHandler();
+		if (handler) {
+			handler();
+		}
 	}
 
 	void Interaction::processHandButtonClick(
@@ -150,6 +278,44 @@ namespace guillaume::systems
 		if (_lastHandButtonEvent == nullptr) {
 			return;
 		}
+
+		auto &interaction =
+			getComponentRegistry().getComponent<components::Interaction>(
+				entityIdentifier);
+		const auto pressed	 = _lastHandButtonEvent->getButtonsState();
+		const auto clicked	 = interaction.getHandButtonsClicked();
+		auto pressing		 = pressed & ~clicked;
+		const auto releasing = clicked & ~pressed;
+		if (!isInside) {
+			pressing.reset();
+		}
+		if (pressing.none() && releasing.none()) {
+			return;
+		}
+
+		for (std::size_t buttonIndex = 0;
+			 buttonIndex < components::Interaction::HandButtonCount;
+			 ++buttonIndex) {
+			const auto button =
+				static_cast<utility::event::HandButtonEvent::Button>(
+					buttonIndex);
+
+			if (pressing.test(buttonIndex)) {
+				interaction.setHandButtonClicked(button, true);
+				const auto onClickHandler =
+					interaction.getHandButtonOnClickHandler(button);
+				if (onClickHandler) {
+					onClickHandler();
+				}
+			} else if (releasing.test(buttonIndex)) {
+				interaction.setHandButtonClicked(button, false);
+				const auto onReleaseHandler =
+					interaction.getHandButtonOnClickReleaseHandler(button);
+				if (isInside && onReleaseHandler) {
+					onReleaseHandler();
+				}
+			}
+		}
 	}
 
 	void Interaction::processHandPinch(
@@ -158,6 +324,20 @@ namespace guillaume::systems
 		if (_lastHandPinchEvent == nullptr) {
 			return;
 		}
+
+		auto &interaction =
+			getComponentRegistry().getComponent<components::Interaction>(
+				entityIdentifier);
+		const bool isPinched = isInside && _hasNewHandPinch;
+		if (interaction.isHandPinched() == isPinched) {
+			return;
+		}
+
+		interaction.setHandPinched(isPinched);
+		const auto onPinch = interaction.getHandPinchHandler();
+		if (isPinched && onPinch) {
+			onPinch();
+		}
 	}
 
 	void Interaction::processHandPoke(
@@ -166,11 +346,27 @@ namespace guillaume::systems
 		if (_lastHandPokeEvent == nullptr) {
 			return;
 		}
+
+		auto &interaction =
+			getComponentRegistry().getComponent<components::Interaction>(
+				entityIdentifier);
+		const bool isPoked = isInside && _hasNewHandPoke;
+		if (interaction.isHandPoked() == isPoked) {
+			return;
+		}
+
+		interaction.setHandPoked(isPoked);
+		const auto onPoke = interaction.getHandPokeHandler();
+		if (isPoked && onPoke) {
+			onPoke();
+		}
 	}
 
 	Interaction::Interaction(event::EventBus &eventBus, Renderer &renderer)
-		: ecs::SystemFiller<components::Interaction, components::Transform,
-							components::Bound>(ecs::System::Phase::Event)
+		: ecs::SystemFiller<
+			  ecs::Writes<components::Interaction>,
+			  ecs::Reads<components::Transform, components::Bound>>(
+			  ecs::System::Phase::Event)
 		, _mouseButtonSubscriber(eventBus)
 		, _mouseMotionSubscriber(eventBus)
 		, _handButtonSubscriber(eventBus)
@@ -179,12 +375,43 @@ namespace guillaume::systems
 		, _handPokeSubscriber(eventBus)
 		, _renderer(renderer)
 	{
+		// Handlers are user callbacks that may change anything.
+		setExclusive(true);
+	}
+
+	bool Interaction::dispatch(const ecs::Entity::Identifier &entityIdentifier)
+	{
+		const bool isMouseInside = _mouseHit == entityIdentifier;
+		const bool isHandInside =
+			_handHit.has_value() && _handHit->identifier == entityIdentifier;
+
+		processMouseHover(entityIdentifier, isMouseInside);
+
+		processMouseButtonClick(entityIdentifier, isMouseInside);
+
+		processHandHover(entityIdentifier, isHandInside);
+
+		processHandButtonClick(entityIdentifier, isHandInside);
+
+		processHandPinch(entityIdentifier, isHandInside);
+
+		processHandPoke(entityIdentifier, isHandInside);
+
+		const auto &interaction =
+			getComponentRegistry().getComponent<components::Interaction>(
+				entityIdentifier);
+		return interaction.isMouseHovered() || interaction.isHandHovered()
+			|| interaction.getMouseButtonsClicked().any()
+			|| interaction.getHandButtonsClicked().any()
+			|| interaction.isHandPinched() || interaction.isHandPoked();
 	}
 
 	void Interaction::update(const ecs::Entity::Identifier &entityIdentifier)
 	{
-		getLogger().debug("Updating Interaction system for entity "
-						  + std::to_string(entityIdentifier));
+		logging::debug(getLogger(), [&entityIdentifier] {
+			return "Updating Interaction system for entity "
+				+ std::to_string(entityIdentifier);
+		});
 
 		if (!requireComponent<components::Interaction>(entityIdentifier)
 			|| !requireComponent<components::Transform>(entityIdentifier)
@@ -192,21 +419,64 @@ namespace guillaume::systems
 			return;
 		}
 
-		bool isInside = false;
+		const auto engaged = std::lower_bound(_engagedEntities.begin(),
+											  _engagedEntities.end(),
+											  entityIdentifier);
+		const bool wasEngaged =
+			engaged != _engagedEntities.end() && *engaged == entityIdentifier;
+		const bool isEngaged = dispatch(entityIdentifier);
+		if (isEngaged && !wasEngaged) {
+			_engagedEntities.insert(engaged, entityIdentifier);
+		} else if (!isEngaged && wasEngaged) {
+			_engagedEntities.erase(engaged);
+		}
+	}
 
+	void Interaction::updateQuery(const ecs::EntityQuery &query)
+	{
+		if (_indexedRegistry != &getComponentRegistry()) {
+			_engagedEntities.clear();
+		}
 		updateLastInputEvents();
+		updateHitGrid();
+		resolveMouseHit(query);
+		resolveHandHit();
+
+		// The entities under a pointer may enter a state; engaged ones may
+		// leave theirs. No other entity can change this frame. Engaged
+		// entities go first so that leaving one entity is handled before
+		// entering the next.
+		const auto isEngaged = [this](const ecs::Entity::Identifier &id) {
+			return std::binary_search(_engagedEntities.begin(),
+									  _engagedEntities.end(), id);
+		};
+		_dispatchTargets.assign(_engagedEntities.begin(),
+								_engagedEntities.end());
+		if (_mouseHit.has_value() && !isEngaged(*_mouseHit)) {
+			_dispatchTargets.push_back(*_mouseHit);
+		}
+		if (_handHit.has_value() && !isEngaged(_handHit->identifier)
+			&& _mouseHit != _handHit->identifier) {
+			_dispatchTargets.push_back(_handHit->identifier);
+		}
 
-		processMouseHover(entityIdentifier, isInside);
-
-		processMouseButtonClick(entityIdentifier, isInside);
-
-		processHandHover(entityIdentifier, isInside);
-
-		processHandButtonClick(entityIdentifier, isInside);
-
-		processHandPinch(entityIdentifier, isInside);
-
-		processHandPoke(entityIdentifier, isInside);
+		_engagedEntities.clear();
+		for (const auto &entityIdentifier: _dispatchTargets) {
+			// Engaged entities may have been destroyed or lost a component.
+			if (!isInteractive(entityIdentifier)) {
+				continue;
+			}
+			logging::debug(getLogger(), [&entityIdentifier] {
+				return "Dispatching pointers to entity "
+					+ std::to_string(entityIdentifier);
+			});
+			if (dispatch(entityIdentifier)) {
+				_engagedEntities.push_back(entityIdentifier);
+			}
+		}
+		// Entities that start matching meanwhile are not indexed yet, so no
+		// pointer is inside them: the next frame indexes them.
+		std::sort(_engagedEntities.begin(), _engagedEntities.end());
 	}
 
 }	 // namespace guillaume::systems
\ No newline at end of file
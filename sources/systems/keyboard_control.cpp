@@ -47,7 +47,8 @@ namespace guillaume::systems
 {
 
 	KeyboardControl::KeyboardControl(event::EventBus &eventBus)
-		: ecs::SystemFiller<components::Text, components::Focus>(
+		: ecs::SystemFiller<ecs::Writes<components::Text>,
+							ecs::Reads<components::Focus>>(
 			  ecs::System::Phase::Event)
 		, _keyboardSubscriber(eventBus)
 	{
@@ -56,8 +57,10 @@ namespace guillaume::systems
 	void
 		KeyboardControl::update(const ecs::Entity::Identifier &entityIdentifier)
 	{
-		getLogger().debug("Updating KeyboardControl system for entity "
-						  + std::to_string(entityIdentifier));
+		logging::debug(getLogger(), [&entityIdentifier] {
+			return "Updating KeyboardControl system for entity "
+				+ std::to_string(entityIdentifier);
+		});
 		if (!_keyboardSubscriber.hasPendingEvents()) {
 			return;
 		}
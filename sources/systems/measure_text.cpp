@@ -28,12 +28,15 @@ namespace guillaume::systems
 {
 
 	MeasureText::MeasureText(Renderer &renderer)
-		: ecs::SystemFiller<components::Text, components::Bound>(
+		: ecs::SystemFiller<ecs::Reads<components::Text>,
+							ecs::Writes<components::Bound>>(
 			  ecs::System::Phase::Measure)
 		, _renderer(renderer)
 		, _defaultFontPath(
 			  "assets/fonts/Roboto/Roboto-VariableFont_wdth,wght.ttf")
 	{
+		// Text measurement goes through the shared renderer.
+		setExclusive(true);
 	}
 
 	MeasureText::~MeasureText(void)
@@ -42,27 +45,36 @@ namespace guillaume::systems
 
 	void MeasureText::update(const ecs::Entity::Identifier &entityIdentifier)
 	{
-		getLogger().debug("Updating MeasureText system for entity "
-						  + std::to_string(entityIdentifier));
-		if (!requireComponent<components::Text>(entityIdentifier)
-			|| !requireComponent<components::Bound>(entityIdentifier)) {
-			return;
-		}
+		updateBatch(std::span<const ecs::Entity::Identifier>(
+			&entityIdentifier, 1));
+	}
 
-		const auto &textComponent =
-			getComponent<components::Text>(entityIdentifier);
-		auto &boundComponent =
-			getComponent<components::Bound>(entityIdentifier);
+	void MeasureText::updateBatch(
+		std::span<const ecs::Entity::Identifier> entities)
+	{
+		auto &texts	 = getBoundStorage<components::Text>();
+		auto &bounds = getBoundStorage<components::Bound>();
 
-		utility::graphic::Text text(
-			_renderer.getRessourceManager(), _renderer.getAssetManager(),
-			textComponent.getContent(),
-			textComponent.getFontSize(), _defaultFontPath);
-		text.setColor(utility::graphic::Color32Bit());
+		// Measuring goes through the renderer, so this loop stays serial.
+		for (const auto &entityIdentifier: entities) {
+			const auto *textComponent = texts.find(entityIdentifier);
+			auto *boundComponent	  = bounds.find(entityIdentifier);
+			if (textComponent == nullptr || boundComponent == nullptr) {
+				requireComponent<components::Text>(entityIdentifier);
+				requireComponent<components::Bound>(entityIdentifier);
+				continue;
+			}
 
-		auto textSize = _renderer.measureText(text);
+			utility::graphic::Text text(
+				_renderer.getRessourceManager(), _renderer.getAssetManager(),
+				textComponent->getContent(), textComponent->getFontSize(),
+				_defaultFontPath);
+			text.setColor(utility::graphic::Color32Bit());
 
-		boundComponent.setWidth(textSize[0]).setHeight(textSize[1]);
+			auto textSize = _renderer.measureText(text);
+
+			boundComponent->setWidth(textSize[0]).setHeight(textSize[1]);
+		}
 	}
 
 }	 // namespace guillaume::systems
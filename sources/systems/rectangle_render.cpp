@@ -163,7 +163,7 @@ namespace guillaume::systems
 			const utility::graphic::OrientationF &orientation,
 			const utility::math::Vector2F &scale,
 			const utility::math::Vector2F &size, float radius, int arcSegments,
-			float epsilon)
+			float epsilon) const
 	{
 		const float halfWidth	 = (size[0] / 2.0f) * std::abs(scale[0]);
 		const float halfHeight	 = (size[1] / 2.0f) * std::abs(scale[1]);
@@ -175,21 +175,46 @@ namespace guillaume::systems
 	void RectangleRender::buildTriangleFanVertices(
 		const utility::graphic::PositionF &center,
 		const std::vector<utility::graphic::PositionF> &outline,
-		const utility::graphic::Color32Bit &color)
+		const utility::graphic::Color32Bit &color,
+		std::vector<utility::graphic::VertexF> &vertices) const
 	{
-		_vertices.reserve(outline.size() + 2);
+		vertices.reserve(vertices.size() + outline.size() + 2);
 
 		// OpenGL triangle fan expects the first vertex to be the fan anchor.
-		_vertices.push_back(createVertex(center, color));
+		vertices.push_back(createVertex(center, color));
 		for (const auto &outlineVertex: outline) {
-			_vertices.push_back(createVertex(outlineVertex, color));
+			vertices.push_back(createVertex(outlineVertex, color));
 		}
 
 		if (!outline.empty()) {
-			_vertices.push_back(createVertex(outline.front(), color));
+			vertices.push_back(createVertex(outline.front(), color));
 		}
 	}
 
+	void RectangleRender::buildEntityVertices(
+		const components::Transform &transform,
+		const components::Bound &bound, const components::Color &color,
+		const components::Borders &borders,
+		std::vector<utility::graphic::VertexF> &vertices) const
+	{
+		const auto pose		   = transform.getPose();
+		const auto position	   = pose.getPosition();
+		const auto orientation = pose.getOrientation();
+		const auto width	   = bound.getWidth();
+		const auto height	   = bound.getHeight();
+		const float radius	   = extractAverageRadius(borders);
+
+		const utility::graphic::PositionF center(
+			position[0], position[1] - (height / 2.0f), position[2]);
+		const auto roundedVertices = buildRoundedRectVertices(
+			center, orientation, utility::math::Vector2F({ 1.0f, 1.0f }),
+			utility::math::Vector2F({ (float)width, (float)height }), radius);
+
+		vertices.clear();
+		buildTriangleFanVertices(center, roundedVertices, color.getColor(),
+								 vertices);
+	}
+
 	utility::graphic::VertexF RectangleRender::createVertex(
 		const utility::graphic::PositionF &position,
 		const utility::graphic::Color32Bit &color) const
@@ -201,11 +226,14 @@ namespace guillaume::systems
 	}
 
 	RectangleRender::RectangleRender(Renderer &renderer)
-		: ecs::SystemFiller<components::Transform, components::Bound,
-							components::Color, components::Borders>(
+		: ecs::SystemFiller<
+			  ecs::Reads<components::Transform, components::Bound,
+						 components::Color, components::Borders>>(
 			  ecs::System::Phase::Render)
 		, _renderer(renderer)
 	{
+		// Draw calls go through the shared renderer.
+		setExclusive(true);
 	}
 
 	RectangleRender::~RectangleRender(void)
@@ -215,43 +243,53 @@ namespace guillaume::systems
 	void
 		RectangleRender::update(const ecs::Entity::Identifier &entityIdentifier)
 	{
-		getLogger().debug("Updating RectangleRender system for entity "
-						  + std::to_string(entityIdentifier));
-
-		if (!requireComponent<components::Bound>(entityIdentifier)
-			|| !requireComponent<components::Transform>(entityIdentifier)
-			|| !requireComponent<components::Color>(entityIdentifier)
-			|| !requireComponent<components::Borders>(entityIdentifier)) {
-			return;
-		}
-
-		const auto &transformComponent =
-			getComponent<components::Transform>(entityIdentifier);
-		const auto &boundComponent =
-			getComponent<components::Bound>(entityIdentifier);
-		const auto &colorComponent =
-			getComponent<components::Color>(entityIdentifier);
-		const auto &bordersComponent =
-			getComponent<components::Borders>(entityIdentifier);
-
-		const auto pose		   = transformComponent.getPose();
-		const auto position	   = pose.getPosition();
-		const auto orientation = pose.getOrientation();
-		const auto width	   = boundComponent.getWidth();
-		const auto height	   = boundComponent.getHeight();
-		const auto color	   = colorComponent.getColor();
-		const float radius	   = extractAverageRadius(bordersComponent);
+		updateBatch(std::span<const ecs::Entity::Identifier>(
+			&entityIdentifier, 1));
+	}
 
-		const utility::graphic::PositionF center(
-			position[0], position[1] - (height / 2.0f), position[2]);
-		const auto roundedVertices = buildRoundedRectVertices(
-			center, orientation, utility::math::Vector2F({ 1.0f, 1.0f }),
-			utility::math::Vector2F({ (float)width, (float)height }), radius);
+	void RectangleRender::updateBatch(
+		std::span<const ecs::Entity::Identifier> entities)
+	{
+		const auto &transforms = getBoundStorage<components::Transform>();
+		const auto &bounds	   = getBoundStorage<components::Bound>();
+		const auto &colors	   = getBoundStorage<components::Color>();
+		const auto &borders	   = getBoundStorage<components::Borders>();
 
-		_vertices.clear();
-		buildTriangleFanVertices(center, roundedVertices, color);
+		if (_entityVertices.size() < entities.size()) {
+			_entityVertices.resize(entities.size());
+		}
 
-		_renderer.drawVertices(_vertices);
+		parallelFor(
+			entities.size(), VertexBuildChunkSize,
+			[&](std::size_t begin, std::size_t end) {
+				for (std::size_t index = begin; index < end; ++index) {
+					const auto &entityIdentifier = entities[index];
+					const auto *transform = transforms.find(entityIdentifier);
+					const auto *bound	  = bounds.find(entityIdentifier);
+					const auto *color	  = colors.find(entityIdentifier);
+					const auto *border	  = borders.find(entityIdentifier);
+					if (transform == nullptr || bound == nullptr
+						|| color == nullptr || border == nullptr) {
+						_entityVertices[index].clear();
+						continue;
+					}
+					buildEntityVertices(*transform, *bound, *color, *border,
+										_entityVertices[index]);
+				}
+			});
+
+		// Append in entity order so that overlapping rectangles stack as
+		// before; the renderer draws the whole list at once.
+		auto &commandList = _renderer.getCommandList();
+		for (std::size_t index = 0; index < entities.size(); ++index) {
+			if (_entityVertices[index].empty()) {
+				getLogger().warning(
+					"Entity " + std::to_string(entities[index])
+					+ " is missing a component required by RectangleRender");
+				continue;
+			}
+			commandList.appendTriangleFan(_entityVertices[index]);
+		}
 	}
 
 }	 // namespace guillaume::systems
\ No newline at end of file
@@ -26,7 +26,8 @@ namespace guillaume::systems
 {
 
 	TextInput::TextInput(event::EventBus &eventBus)
-		: ecs::SystemFiller<components::Text, components::Focus>(
+		: ecs::SystemFiller<ecs::Writes<components::Text>,
+							ecs::Reads<components::Focus>>(
 			  ecs::System::Phase::Event)
 		, _textInputSubscriber(eventBus)
 	{
@@ -34,8 +35,10 @@ namespace guillaume::systems
 
 	void TextInput::update(const ecs::Entity::Identifier &entityIdentifier)
 	{
-		getLogger().debug("Updating TextInput system for entity "
-						  + std::to_string(entityIdentifier));
+		logging::debug(getLogger(), [&entityIdentifier] {
+			return "Updating TextInput system for entity "
+				+ std::to_string(entityIdentifier);
+		});
 		if (!_textInputSubscriber.hasPendingEvents()) {
 			return;
 		}
@@ -28,12 +28,15 @@ namespace guillaume::systems
 {
 
 	TextRender::TextRender(Renderer &renderer)
-		: ecs::SystemFiller<components::Transform, components::Text,
-							components::Color>(ecs::System::Phase::Render)
+		: ecs::SystemFiller<ecs::Reads<
+			  components::Transform, components::Text, components::Color>>(
+			  ecs::System::Phase::Render)
 		, _renderer(renderer)
 		, _defaultFontPath(
 			  "assets/fonts/Roboto/Roboto-VariableFont_wdth,wght.ttf")
 	{
+		// Draw calls go through the shared renderer.
+		setExclusive(true);
 	}
 
 	TextRender::~TextRender(void)
@@ -42,28 +45,33 @@ namespace guillaume::systems
 
 	void TextRender::update(const ecs::Entity::Identifier &entityIdentifier)
 	{
-		getLogger().debug("Updating TextRender system for entity "
-						  + std::to_string(entityIdentifier));
-		if (!requireComponent<components::Transform>(entityIdentifier)
-			|| !requireComponent<components::Text>(entityIdentifier)
-			|| !requireComponent<components::Color>(entityIdentifier)) {
+		logging::debug(getLogger(), [&entityIdentifier] {
+			return "Updating TextRender system for entity "
+				+ std::to_string(entityIdentifier);
+		});
+		const auto *transformComponent =
+			findComponent<components::Transform>(entityIdentifier);
+		const auto *textComponent =
+			findComponent<components::Text>(entityIdentifier);
+		const auto *colorComponent =
+			findComponent<components::Color>(entityIdentifier);
+		if (transformComponent == nullptr || textComponent == nullptr
+			|| colorComponent == nullptr) {
+			getLogger().warning(
+				"Entity " + std::to_string(entityIdentifier)
+				+ " is missing a component required by TextRender");
 			return;
 		}
 
-		const auto &transformComponent =
-			getComponent<components::Transform>(entityIdentifier);
-		const auto &textComponent =
-			getComponent<components::Text>(entityIdentifier);
-		const auto &colorComponent =
-			getComponent<components::Color>(entityIdentifier);
-
 		utility::graphic::Text text(
 			_renderer.getRessourceManager(), _renderer.getAssetManager(),
-			textComponent.getContent(), textComponent.getFontSize(),
+			textComponent->getContent(), textComponent->getFontSize(),
 			_defaultFontPath);
-		text.setColor(colorComponent.getColor());
+		text.setColor(colorComponent->getColor());
 
-		_renderer.drawText(text, transformComponent.getPose());
+		// Text is drawn immediately, over the geometry appended before it.
+		_renderer.flush();
+		_renderer.drawText(text, transformComponent->getPose());
 	}
 
 }	 // namespace guillaume::systems
\ No newline at end of file
@@ -0,0 +1,142 @@
+/*
+ Copyright (c) 2026 ETIB Corporation
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy of
+ this software and associated documentation files (the "Software"), to deal in
+ the Software without restriction, including without limitation the rights to
+ use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ of the Software, and to permit persons to whom the Software is furnished to do
+ so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in all
+ copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ SOFTWARE.
+ */
+
+#include "event/test_event_pool.hpp"
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+#include <utility/event/keyboard_event.hpp>
+#include <utility/event/mouse_motion_event.hpp>
+
+#include <guillaume/event/event_bus.hpp>
+#include <guillaume/event/event_handler.hpp>
+#include <guillaume/event/event_subscriber.hpp>
+
+namespace guillaume::event::tests
+{
+
+	static std::atomic<bool> countingAllocations {
+		false
+	};	  ///< Whether operator new counts its calls
+	static std::atomic<std::size_t> allocationCount {
+		0
+	};	  ///< Calls to operator new while counting
+
+}	 // namespace guillaume::event::tests
+
+// Replace the global allocator to count allocations. This file is built as
+// its own test executable, so the other tests keep the standard allocator.
+// GCC cannot tell that the replaced new and delete pair malloc and free.
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+#endif
+
+void *operator new(std::size_t size)
+{
+	if (guillaume::event::tests::countingAllocations.load(
+			std::memory_order_relaxed)) {
+		guillaume::event::tests::allocationCount.fetch_add(
+			1, std::memory_order_relaxed);
+	}
+	if (void *pointer = std::malloc(size == 0 ? 1 : size)) {
+		return pointer;
+	}
+	throw std::bad_alloc();
+}
+
+void operator delete(void *pointer) noexcept
+{
+	std::free(pointer);
+}
+
+void operator delete(void *pointer, std::size_t) noexcept
+{
+	std::free(pointer);
+}
+
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+
+namespace guillaume::event::tests
+{
+
+	TEST_F(TestEventPool, SteadyStateInputAllocatesNothing)
+	{
+		EventBus eventBus;
+		eventBus.setCoalescingPolicy<utility::event::MouseMotionEvent>(
+			CoalescingPolicy::LatestWins);
+		EventSubscriber<utility::event::MouseMotionEvent> motions(eventBus);
+		EventSubscriber<utility::event::KeyboardEvent> keys(eventBus);
+		EventSubscriber<utility::event::KeyboardEvent> shortcuts(eventBus);
+
+		// Mirror the path from an event handler to the subscribers.
+		const EventHandler::Handler callback =
+			[&eventBus](EventHandler::EventPointer event) {
+				eventBus.publish(std::move(event));
+			};
+		auto frame = [&](void) {
+			for (int x = 0; x < 16; ++x) {
+				auto motion = makeEvent<utility::event::MouseMotionEvent>();
+				motion->setPosition({ static_cast<float>(x), 0.0f });
+				callback(std::move(motion));
+			}
+			for (int i = 0; i < 4; ++i) {
+				auto key = makeEvent<utility::event::KeyboardEvent>();
+				key->setIsDownEvent(i % 2 == 0);
+				callback(std::move(key));
+			}
+			eventBus.flush();
+			std::size_t consumed = 0;
+			for (auto *subscriber: { &keys, &shortcuts }) {
+				while (subscriber->hasPendingEvents()) {
+					consumed += subscriber->getNextEvent() ? 1 : 0;
+				}
+			}
+			while (motions.hasPendingEvents()) {
+				consumed += motions.getNextEvent() ? 1 : 0;
+			}
+			return consumed;
+		};
+
+		for (int i = 0; i < 4; ++i) {
+			frame();
+		}
+		const auto chunkCount = EventPool::getInstance().getChunkCount();
+
+		std::size_t consumed = 0;
+		allocationCount.store(0);
+		countingAllocations.store(true);
+		for (int i = 0; i < 1000; ++i) {
+			consumed += frame();
+		}
+		countingAllocations.store(false);
+
+		EXPECT_EQ(allocationCount.load(), 0U);
+		EXPECT_EQ(consumed, 1000U * (4 + 4 + 1));
+		EXPECT_EQ(EventPool::getInstance().getChunkCount(), chunkCount);
+	}
+
+}	 // namespace guillaume::event::tests
\ No newline at end of file
@@ -0,0 +1,133 @@
+/*
+ Copyright (c) 2026 ETIB Corporation
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy of
+ this software and associated documentation files (the "Software"), to deal in
+ the Software without restriction, including without limitation the rights to
+ use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ of the Software, and to permit persons to whom the Software is furnished to do
+ so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in all
+ copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ SOFTWARE.
+ */
+
+#include "ecs/test_command_buffer.hpp"
+
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+namespace guillaume::ecs::tests
+{
+
+	class CommandComponent: public Component
+	{
+	};
+
+	class CommandEntity: public Entity
+	{
+		public:
+		CommandEntity(ComponentRegistry &componentRegistry)
+		{
+			setSignature(getSignatureFromTypes<CommandComponent>());
+			componentRegistry.addComponent<CommandComponent>(getIdentifier());
+		}
+	};
+
+	class CommandEntityRegistry final: public EntityRegistry
+	{
+		private:
+		std::vector<std::unique_ptr<Entity>> _entities;
+
+		protected:
+		std::vector<std::unique_ptr<Entity>> &accessDirectEntities(void) override
+		{
+			return _entities;
+		}
+
+		const std::vector<std::unique_ptr<Entity>> &
+			accessDirectEntities(void) const override
+		{
+			return _entities;
+		}
+	};
+
+	TEST_F(TestCommandBuffer, ChangesAreDeferredUntilApplied)
+	{
+		ComponentRegistry componentRegistry;
+		CommandEntityRegistry entityRegistry;
+		CommandBuffer commandBuffer;
+
+		entityRegistry.addEntity(
+			std::make_unique<CommandEntity>(componentRegistry));
+		const auto destroyedIdentifier =
+			entityRegistry.getEntities().front()->getIdentifier();
+
+		commandBuffer.destroyEntity(destroyedIdentifier);
+		commandBuffer.createEntity([](ComponentRegistry &registry) {
+			return std::make_unique<CommandEntity>(registry);
+		});
+		commandBuffer.record(
+			[&commandBuffer](ComponentRegistry &, EntityRegistry &registry) {
+				const auto identifier =
+					registry.getEntities().back()->getIdentifier();
+				commandBuffer.removeComponent<CommandComponent>(identifier);
+			});
+
+		EXPECT_EQ(commandBuffer.size(), 3U);
+		ASSERT_EQ(entityRegistry.getEntities().size(), 1U);
+		EXPECT_EQ(componentRegistry.getStorage<CommandComponent>().size(), 1U);
+
+		commandBuffer.apply(componentRegistry, entityRegistry);
+
+		EXPECT_TRUE(commandBuffer.empty());
+		ASSERT_EQ(entityRegistry.getEntities().size(), 1U);
+		EXPECT_EQ(entityRegistry.findEntity(destroyedIdentifier), nullptr);
+		EXPECT_EQ(componentRegistry.getStorage<CommandComponent>().size(), 0U);
+	}
+
+	TEST_F(TestCommandBuffer, ChangesAfterAThrowingOneAreKept)
+	{
+		ComponentRegistry componentRegistry;
+		CommandEntityRegistry entityRegistry;
+		CommandBuffer commandBuffer;
+		std::vector<int> applied;
+
+		commandBuffer.record(
+			[&applied](ComponentRegistry &, EntityRegistry &) {
+				applied.push_back(1);
+			});
+		commandBuffer.record(
+			[&commandBuffer, &applied](ComponentRegistry &,
+									   EntityRegistry &) {
+				commandBuffer.record(
+					[&applied](ComponentRegistry &, EntityRegistry &) {
+						applied.push_back(4);
+					});
+				throw std::runtime_error("failed");
+			});
+		commandBuffer.record(
+			[&applied](ComponentRegistry &, EntityRegistry &) {
+				applied.push_back(3);
+			});
+
+		EXPECT_THROW(commandBuffer.apply(componentRegistry, entityRegistry),
+					 std::runtime_error);
+		EXPECT_EQ(applied, std::vector<int> { 1 });
+		EXPECT_EQ(commandBuffer.size(), 2U);
+
+		commandBuffer.apply(componentRegistry, entityRegistry);
+		EXPECT_EQ(applied, (std::vector<int> { 1, 3, 4 }));
+		EXPECT_TRUE(commandBuffer.empty());
+	}
+
+}	 // namespace guillaume::ecs::tests
@@ -22,6 +22,244 @@
 
 #include "ecs/test_component_registry.hpp"
 
+#include <array>
+#include <set>
+#include <stdexcept>
+#include <string_view>
+#include <thread>
+#include <utility>
+#include <vector>
+
 namespace guillaume::ecs::tests
 {
-}	 // namespace guillaume::ecs::tests
\ No newline at end of file
+
+	class DummyComponent: public Component
+	{
+		public:
+		int value { 0 };
+
+		DummyComponent(void) = default;
+
+		DummyComponent(int initialValue)
+			: value(initialValue)
+		{
+		}
+	};
+
+	class OtherDummyComponent: public Component
+	{
+	};
+
+	class NamedDummyComponent: public Component
+	{
+		public:
+		constexpr static std::string_view StableName = "NamedDummyComponent";
+	};
+
+	class RenamedDummyComponent: public Component
+	{
+		public:
+		constexpr static std::string_view StableName = "NamedDummyComponent";
+	};
+
+	template<std::size_t Index> class IndexedDummyComponent: public Component
+	{
+	};
+
+	template<std::size_t... Indices>
+	static void addIndexedComponents(ComponentRegistry &registry,
+									 const Entity::Identifier &identifier,
+									 std::index_sequence<Indices...>)
+	{
+		(registry.addComponent<IndexedDummyComponent<Indices>>(identifier),
+		 ...);
+	}
+
+	TEST_F(TestComponentRegistry, StoragePacksComponentsDensely)
+	{
+		ComponentStorage<DummyComponent> storage;
+
+		storage.emplace(7, 70);
+		storage.emplace(3, 30);
+		storage.emplace(9000, 90);
+
+		ASSERT_EQ(storage.size(), 3U);
+		EXPECT_EQ(storage.getIdentifiers(),
+				  (std::vector<Entity::Identifier> { 7, 3, 9000 }));
+		EXPECT_EQ(storage.getComponents()[1].value, 30);
+		ASSERT_NE(storage.find(9000), nullptr);
+		EXPECT_EQ(storage.find(9000)->value, 90);
+		EXPECT_EQ(storage.find(8), nullptr);
+	}
+
+	TEST_F(TestComponentRegistry, StorageRemoveKeepsRemainingLookupsValid)
+	{
+		ComponentStorage<DummyComponent> storage;
+
+		storage.emplace(1, 10);
+		storage.emplace(2, 20);
+		storage.emplace(3, 30);
+		storage.remove(1);
+		storage.remove(42);
+
+		ASSERT_EQ(storage.size(), 2U);
+		EXPECT_FALSE(storage.has(1));
+		EXPECT_EQ(storage.getIdentifiers().front(), 3U);
+		ASSERT_NE(storage.find(2), nullptr);
+		EXPECT_EQ(storage.find(2)->value, 20);
+		ASSERT_NE(storage.find(3), nullptr);
+		EXPECT_EQ(storage.find(3)->value, 30);
+	}
+
+	TEST_F(TestComponentRegistry, AddComponentReplacesExistingComponent)
+	{
+		ComponentRegistry registry;
+
+		registry.addComponent<DummyComponent>(5, 1);
+		registry.addComponent<DummyComponent>(5, 2);
+
+		EXPECT_EQ(registry.getStorage<DummyComponent>().size(), 1U);
+		EXPECT_EQ(registry.getComponent<DummyComponent>(5).value, 2);
+		EXPECT_THROW(registry.getComponent<DummyComponent>(6),
+					 EntityComponentNotFoundException<DummyComponent>);
+	}
+
+	TEST_F(TestComponentRegistry, ArchetypeAlignsColumnsOfMatchingEntities)
+	{
+		ComponentRegistry registry;
+
+		registry.addComponent<DummyComponent>(1, 10);
+		registry.addComponent<DummyComponent>(2, 20);
+		registry.addComponent<OtherDummyComponent>(2);
+		auto &archetype =
+			registry.registerArchetype<DummyComponent, OtherDummyComponent>();
+		registry.addComponent<DummyComponent>(3, 30);
+		registry.addComponent<OtherDummyComponent>(3);
+
+		ASSERT_EQ(archetype.size(), 2U);
+		EXPECT_FALSE(archetype.contains(1));
+		const auto identifiers = archetype.getIdentifiers();
+		const auto values =
+			archetype.getColumn(registry.getStorage<DummyComponent>());
+		for (std::size_t index = 0; index < archetype.size(); ++index) {
+			EXPECT_EQ(values[index].value,
+					  static_cast<int>(identifiers[index]) * 10);
+			EXPECT_EQ(registry.getStorage<OtherDummyComponent>()
+						  .getIdentifiers()[index],
+					  identifiers[index]);
+		}
+
+		registry.removeComponent<OtherDummyComponent>(2);
+
+		ASSERT_EQ(archetype.size(), 1U);
+		EXPECT_EQ(archetype.getIdentifiers()[0], 3U);
+		EXPECT_EQ(registry.getComponent<DummyComponent>(2).value, 20);
+		EXPECT_EQ(
+			(registry.getArchetype<DummyComponent, OtherDummyComponent>()),
+			&archetype);
+
+		ComponentRegistry otherRegistry;
+		EXPECT_THROW(
+			archetype.getColumn(otherRegistry.getStorage<DummyComponent>()),
+			std::invalid_argument);
+	}
+
+	TEST_F(TestComponentRegistry, ChangesAreRecordedOncePerResetWithFrame)
+	{
+		ComponentRegistry registry;
+		registry.addComponent<DummyComponent>(1, 10);
+		registry.addComponent<OtherDummyComponent>(1);
+		registry.addComponent<DummyComponent>(2, 20);
+
+		registry.getComponent<DummyComponent>(2).setHasChanged(true);
+		registry.getComponent<DummyComponent>(2).setHasChanged(true);
+		registry.getComponent<DummyComponent>(1).setHasChanged(true);
+		registry.getComponent<OtherDummyComponent>(1).setHasChanged(true);
+
+		EXPECT_EQ(registry.getPendingChanges(),
+				  (std::vector<Entity::Identifier> { 2, 1 }));
+		EXPECT_EQ(registry.getChangesSince<DummyComponent>(0).size(), 2U);
+
+		registry.resetChangedFlags();
+		EXPECT_TRUE(registry.getPendingChanges().empty());
+		EXPECT_FALSE(registry.hasChanged(1));
+
+		registry.advanceFrame();
+		registry.getComponent<DummyComponent>(2).setHasChanged(true);
+
+		const auto changes =
+			registry.getChangesSince<DummyComponent>(registry.getFrame());
+		ASSERT_EQ(changes.size(), 1U);
+		EXPECT_EQ(changes[0].identifier, 2U);
+		EXPECT_EQ(registry.getChangesSince<DummyComponent>(0).size(), 3U);
+	}
+
+	TEST_F(TestComponentRegistry, RemovalsAreRecordedWithFrame)
+	{
+		ComponentRegistry registry;
+		registry.addComponent<DummyComponent>(1, 10);
+		registry.addComponent<OtherDummyComponent>(1);
+		registry.addComponent<DummyComponent>(2, 20);
+		registry.resetChangedFlags();
+		registry.advanceFrame();
+
+		registry.removeComponent<DummyComponent>(2);
+		registry.removeComponent<DummyComponent>(3);
+		registry.destroyEntity(1);
+
+		const auto removals =
+			registry.getRemovalsSince<DummyComponent>(registry.getFrame());
+		ASSERT_EQ(removals.size(), 2U);
+		EXPECT_EQ(removals[0].identifier, 2U);
+		EXPECT_EQ(removals[1].identifier, 1U);
+		EXPECT_EQ(registry.getRemovalsSince<OtherDummyComponent>(0).size(),
+				  1U);
+		EXPECT_TRUE(registry.getPendingChanges().empty());
+
+		registry.advanceFrame();
+		EXPECT_TRUE(
+			registry.getRemovalsSince<DummyComponent>(registry.getFrame())
+				.empty());
+	}
+
+	TEST_F(TestComponentRegistry, SignaturesHoldMoreThanSixtyFourTypes)
+	{
+		ComponentRegistry registry;
+		addIndexedComponents(registry, 1, std::make_index_sequence<80>());
+
+		const auto signature =
+			Entity::getSignatureFromTypes<IndexedDummyComponent<0>,
+										  IndexedDummyComponent<79>>();
+		EXPECT_EQ(signature.count(), 2U);
+		EXPECT_GE(ComponentTypeId::get<IndexedDummyComponent<79>>(), 64U);
+		EXPECT_TRUE(registry.hasComponent<IndexedDummyComponent<79>>(1));
+	}
+
+	TEST_F(TestComponentRegistry, ComponentTypeIdsAreStableAndThreadSafe)
+	{
+		constexpr auto stableId =
+			ComponentTypeId::getStableId<OtherDummyComponent>();
+		static_assert(stableId
+					  != ComponentTypeId::getStableId<DummyComponent>());
+		static_assert(ComponentTypeId::getStableId<NamedDummyComponent>()
+					  == ComponentTypeId::getStableId<
+						  RenamedDummyComponent>());
+		const std::size_t id = ComponentTypeId::get<OtherDummyComponent>();
+		EXPECT_EQ(ComponentTypeId::find(stableId), id);
+
+		std::array<std::size_t, 8> ids {};
+		[&ids]<std::size_t... Indices>(std::index_sequence<Indices...>) {
+			std::vector<std::thread> threads;
+			(threads.emplace_back([&ids] {
+				using Type	 = IndexedDummyComponent<100 + Indices>;
+				ids[Indices] = ComponentTypeId::get<Type>();
+			}),
+			 ...);
+			for (auto &thread: threads) {
+				thread.join();
+			}
+		}(std::make_index_sequence<8>());
+		EXPECT_EQ(std::set<std::size_t>(ids.begin(), ids.end()).size(), 8U);
+	}
+
+}	 // namespace guillaume::ecs::tests
@@ -22,6 +22,85 @@
 
 #include "ecs/test_entity.hpp"
 
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include <guillaume/ecs/entity_pool.hpp>
+
 namespace guillaume::ecs::tests
 {
+
+	class PooledEntity: public Entity
+	{
+		private:
+		std::array<std::byte, 200> _payload {};	   ///< Unique object size
+	};
+
+	class alignas(64) OverAlignedEntity: public Entity
+	{
+	};
+
+	class TrimmedEntity: public Entity
+	{
+		private:
+		std::array<std::byte, 300> _payload {};	   ///< Unique object size
+	};
+
+	TEST_F(TestEntity, EntitiesAreAllocatedFromThePool)
+	{
+		auto &pool = EntityPool::getInstance();
+		constexpr std::size_t objectSize =
+			(sizeof(PooledEntity) + EntityPool::Granularity - 1)
+			/ EntityPool::Granularity * EntityPool::Granularity;
+		std::vector<std::unique_ptr<Entity>> entities;
+		for (std::size_t index = 0; index < EntityPool::ObjectsPerBlock;
+			 ++index) {
+			entities.push_back(std::make_unique<PooledEntity>());
+		}
+		EXPECT_EQ(pool.getBlockCount(sizeof(PooledEntity)), 1U);
+		EXPECT_EQ(reinterpret_cast<std::byte *>(entities[1].get())
+					  - reinterpret_cast<std::byte *>(entities[0].get()),
+				  static_cast<std::ptrdiff_t>(objectSize));
+
+		entities.clear();
+		for (std::size_t index = 0; index < EntityPool::ObjectsPerBlock;
+			 ++index) {
+			entities.push_back(std::make_unique<PooledEntity>());
+		}
+		EXPECT_EQ(pool.getBlockCount(sizeof(PooledEntity)), 1U);
+	}
+
+	TEST_F(TestEntity, OverAlignedEntitiesKeepTheirAlignment)
+	{
+		auto entity = std::make_unique<OverAlignedEntity>();
+		EXPECT_EQ(reinterpret_cast<std::uintptr_t>(entity.get())
+					  % alignof(OverAlignedEntity),
+				  0U);
+	}
+
+	TEST_F(TestEntity, TrimReleasesBlocksWithoutLiveEntities)
+	{
+		auto &pool = EntityPool::getInstance();
+		std::vector<std::unique_ptr<Entity>> entities;
+		for (std::size_t index = 0; index <= EntityPool::ObjectsPerBlock;
+			 ++index) {
+			entities.push_back(std::make_unique<TrimmedEntity>());
+		}
+		EXPECT_EQ(pool.getBlockCount(sizeof(TrimmedEntity)), 2U);
+
+		entities.erase(entities.begin() + 1, entities.end());
+		pool.trim();
+		EXPECT_EQ(pool.getBlockCount(sizeof(TrimmedEntity)), 1U);
+
+		entities.clear();
+		pool.trim();
+		EXPECT_EQ(pool.getBlockCount(sizeof(TrimmedEntity)), 0U);
+
+		entities.push_back(std::make_unique<TrimmedEntity>());
+		EXPECT_EQ(pool.getBlockCount(sizeof(TrimmedEntity)), 1U);
+	}
+
 }	 // namespace guillaume::ecs::tests
\ No newline at end of file
@@ -23,7 +23,9 @@
 #include "ecs/test_entity_registry.hpp"
 
 #include <memory>
+#include <vector>
 
+#include "guillaume/ecs/component_registry.hpp"
 #include "guillaume/ecs/parent_entity.hpp"
 
 namespace guillaume::ecs::tests
@@ -33,6 +35,10 @@ namespace guillaume::ecs::tests
 	{
 	};
 
+	class HierarchyComponent: public Component
+	{
+	};
+
 	class DummyParentEntity: public ParentEntity
 	{
 	};
@@ -126,4 +132,198 @@ namespace guillaume::ecs::tests
 		EXPECT_NE(parentIdentifier, Entity::InvalidIdentifier);
 	}
 
+	TEST_F(TestEntityRegistry, GetQueryTracksHierarchyChanges)
+	{
+		TestEntityRegistryContainer registry;
+		Entity::Signature signature;
+		signature.set(7);
+
+		auto parent		= std::make_unique<DummyParentEntity>();
+		auto *rawParent = parent.get();
+		registry.addEntity(std::move(parent));
+
+		const EntityQuery &query = registry.getQuery(signature);
+		EXPECT_EQ(query.size(), 0U);
+		EXPECT_EQ(&registry.getQuery(signature), &query);
+
+		auto child	   = std::make_unique<DummyEntity>();
+		auto *rawChild = child.get();
+		child->setSignature(signature);
+		rawParent->addEntity(std::move(child));
+
+		ASSERT_EQ(query.size(), 1U);
+		EXPECT_EQ(query.getIdentifiers()[0], rawChild->getIdentifier());
+
+		rawChild->setSignature(Entity::Signature());
+		EXPECT_EQ(query.size(), 0U);
+
+		rawParent->setSignature(signature);
+		ASSERT_EQ(query.size(), 1U);
+		EXPECT_EQ(query.getIdentifiers()[0], rawParent->getIdentifier());
+	}
+
+	TEST_F(TestEntityRegistry, HierarchyTraversalsFollowInsertionOrder)
+	{
+		TestEntityRegistryContainer registry;
+		auto parent		 = std::make_unique<DummyParentEntity>();
+		auto *rawParent	 = parent.get();
+		auto sibling	 = std::make_unique<DummyEntity>();
+		auto *rawSibling = sibling.get();
+		auto child		 = std::make_unique<DummyEntity>();
+		auto *rawChild	 = child.get();
+		registry.addEntity(std::move(parent));
+		registry.addEntity(std::move(sibling));
+		rawParent->addEntity(std::move(child));
+
+		std::vector<Entity *> depthFirst;
+		registry.getHierarchy().forEachDepthFirst(
+			EntityHierarchy::RootNode,
+			[&depthFirst](Entity &entity) { depthFirst.push_back(&entity); });
+		EXPECT_EQ(depthFirst,
+				  (std::vector<Entity *> { rawParent, rawChild, rawSibling }));
+		EXPECT_EQ(registry.getEntitiesBreadthFirst(),
+				  (std::vector<Entity *> { rawParent, rawSibling, rawChild }));
+		EXPECT_EQ(registry.getEntityCount(), 3U);
+		EXPECT_EQ(rawParent->getEntityCount(), 1U);
+	}
+
+	TEST_F(TestEntityRegistry, BreadthFirstTraversalsVisitDeepChainsAndNest)
+	{
+		TestEntityRegistryContainer registry;
+		auto root		 = std::make_unique<DummyParentEntity>();
+		auto *rawRoot	 = root.get();
+		auto sibling	 = std::make_unique<DummyEntity>();
+		auto *rawSibling = sibling.get();
+		registry.addEntity(std::move(root));
+		registry.addEntity(std::move(sibling));
+
+		std::vector<Entity *> expected { rawRoot, rawSibling };
+		ParentEntity *parent = rawRoot;
+		for (int depth = 0; depth < 64; ++depth) {
+			auto child	   = std::make_unique<DummyParentEntity>();
+			auto *rawChild = child.get();
+			parent->addEntity(std::move(child));
+			expected.push_back(rawChild);
+			parent = rawChild;
+		}
+
+		std::vector<Entity *> visited;
+		std::size_t nestedVisits = 0;
+		registry.getHierarchy().forEachBreadthFirst([&](Entity &entity) {
+			visited.push_back(&entity);
+			registry.getHierarchy().forEachBreadthFirst(
+				[&nestedVisits](Entity &) { ++nestedVisits; });
+		});
+		EXPECT_EQ(visited, expected);
+		EXPECT_EQ(nestedVisits, expected.size() * expected.size());
+	}
+
+	TEST_F(TestEntityRegistry, GetQueryListsEntitiesBreadthFirst)
+	{
+		TestEntityRegistryContainer registry;
+		Entity::Signature signature;
+		signature.set(7);
+
+		auto parent		= std::make_unique<DummyParentEntity>();
+		auto *rawParent = parent.get();
+		auto child		= std::make_unique<DummyEntity>();
+		auto sibling	= std::make_unique<DummyEntity>();
+		parent->setSignature(signature);
+		child->setSignature(signature);
+		sibling->setSignature(signature);
+		parent->addEntity(std::move(child));
+		registry.addEntity(std::move(parent));
+		registry.addEntity(std::move(sibling));
+
+		const EntityQuery &query = registry.getQuery(signature);
+		EXPECT_EQ(query.getIdentifiers(),
+				  registry.getEntityWithSignature(signature));
+
+		auto lateChild = std::make_unique<DummyEntity>();
+		lateChild->setSignature(signature);
+		rawParent->addEntity(std::move(lateChild));
+		auto lateSibling = std::make_unique<DummyEntity>();
+		lateSibling->setSignature(signature);
+		registry.addEntity(std::move(lateSibling));
+
+		EXPECT_EQ(&registry.getQuery(signature), &query);
+		EXPECT_EQ(query.getIdentifiers(),
+				  registry.getEntityWithSignature(signature));
+	}
+
+	TEST_F(TestEntityRegistry, GetQueryInsertsMatchingEntitiesInPlace)
+	{
+		TestEntityRegistryContainer registry;
+		Entity::Signature signature;
+		signature.set(7);
+
+		auto first					= std::make_unique<DummyEntity>();
+		auto middle					= std::make_unique<DummyEntity>();
+		auto *rawMiddle				= middle.get();
+		auto last					= std::make_unique<DummyEntity>();
+		const auto firstIdentifier	= first->getIdentifier();
+		const auto middleIdentifier	= middle->getIdentifier();
+		const auto lastIdentifier	= last->getIdentifier();
+		first->setSignature(signature);
+		last->setSignature(signature);
+		registry.addEntity(std::move(first));
+		registry.addEntity(std::move(middle));
+		registry.addEntity(std::move(last));
+
+		const EntityQuery &query		 = registry.getQuery(signature);
+		const std::size_t insertionCount = query.getInsertionCount();
+		EXPECT_EQ(query.getPosition(middleIdentifier),
+				  EntityQuery::InvalidPosition);
+
+		rawMiddle->setSignature(signature);
+		EXPECT_EQ(query.getInsertionCount(), insertionCount + 1);
+		EXPECT_EQ(query.getIdentifiers(),
+				  (EntityQuery::Identifiers { firstIdentifier,
+											  middleIdentifier,
+											  lastIdentifier }));
+		EXPECT_EQ(query.getPosition(middleIdentifier), 1U);
+		EXPECT_EQ(query.getPosition(lastIdentifier), 2U);
+
+		rawMiddle->setSignature(Entity::Signature());
+		EXPECT_EQ(query.getPosition(middleIdentifier),
+				  EntityQuery::InvalidPosition);
+		EXPECT_EQ(query.getPosition(lastIdentifier), 1U);
+	}
+
+	TEST_F(TestEntityRegistry, DestroyEntityFreesSubtreeAndRecyclesSlot)
+	{
+		TestEntityRegistryContainer registry;
+		ComponentRegistry componentRegistry;
+		const auto signature =
+			Entity::getSignatureFromTypes<HierarchyComponent>();
+
+		auto parent					= std::make_unique<DummyParentEntity>();
+		auto child					= std::make_unique<DummyEntity>();
+		const auto parentIdentifier = parent->getIdentifier();
+		const auto childIdentifier	= child->getIdentifier();
+		child->setSignature(signature);
+		componentRegistry.addComponent<HierarchyComponent>(childIdentifier);
+		parent->addEntity(std::move(child));
+		registry.addEntity(std::move(parent));
+
+		const EntityQuery &query = registry.getQuery(signature);
+		ASSERT_EQ(query.size(), 1U);
+
+		EXPECT_TRUE(
+			registry.destroyEntity(parentIdentifier, componentRegistry));
+		EXPECT_TRUE(registry.getEntities().empty());
+		EXPECT_EQ(query.size(), 0U);
+		EXPECT_EQ(registry.findEntity(childIdentifier), nullptr);
+		EXPECT_FALSE(componentRegistry.hasComponent<HierarchyComponent>(
+			childIdentifier));
+		EXPECT_FALSE(Entity::isAlive(childIdentifier));
+		EXPECT_FALSE(
+			registry.destroyEntity(childIdentifier, componentRegistry));
+
+		DummyEntity reused;
+		EXPECT_NE(reused.getIdentifier(), childIdentifier);
+		EXPECT_TRUE(Entity::isAlive(reused.getIdentifier()));
+		EXPECT_GT(Entity::getGeneration(reused.getIdentifier()), 1U);
+	}
+
 }  // namespace guillaume::ecs::tests
\ No newline at end of file
@@ -22,6 +22,206 @@
 
 #include "ecs/test_system.hpp"
 
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+#include <guillaume/ecs/parent_entity.hpp>
+#include <guillaume/ecs/system_filler.hpp>
+
 namespace guillaume::ecs::tests
 {
+
+	class BatchComponent: public Component
+	{
+	};
+
+	class CounterComponent: public Component
+	{
+		public:
+		int count { 0 };
+	};
+
+	class BatchEntity: public Entity
+	{
+		public:
+		BatchEntity(ComponentRegistry &componentRegistry)
+		{
+			setSignature(
+				getSignatureFromTypes<BatchComponent, CounterComponent>());
+			componentRegistry.addComponent<BatchComponent>(getIdentifier());
+			componentRegistry.addComponent<CounterComponent>(getIdentifier());
+		}
+	};
+
+	class BatchEntityRegistry final: public EntityRegistry
+	{
+		private:
+		std::vector<std::unique_ptr<Entity>> _entities;
+
+		protected:
+		std::vector<std::unique_ptr<Entity>> &accessDirectEntities(void) override
+		{
+			return _entities;
+		}
+
+		const std::vector<std::unique_ptr<Entity>> &
+			accessDirectEntities(void) const override
+		{
+			return _entities;
+		}
+	};
+
+	class OrderedEntity: public Entity
+	{
+		private:
+		std::vector<Entity::Identifier> &_updates;
+
+		public:
+		OrderedEntity(ComponentRegistry &componentRegistry,
+					  std::vector<Entity::Identifier> &updates)
+			: _updates(updates)
+		{
+			componentRegistry.addComponent<CounterComponent>(getIdentifier());
+		}
+
+		void update(void) override
+		{
+			_updates.push_back(getIdentifier());
+		}
+	};
+
+	class OrderedParentEntity: public ParentEntity
+	{
+		private:
+		std::vector<Entity::Identifier> &_updates;
+
+		public:
+		OrderedParentEntity(ComponentRegistry &componentRegistry,
+							std::vector<Entity::Identifier> &updates)
+			: _updates(updates)
+		{
+			componentRegistry.addComponent<CounterComponent>(getIdentifier());
+		}
+
+		void update(void) override
+		{
+			_updates.push_back(getIdentifier());
+		}
+	};
+
+	class BatchSystem final: public SystemFiller<Reads<BatchComponent>>
+	{
+		private:
+		BatchEntityRegistry &_entityRegistry;
+
+		public:
+		std::vector<std::size_t> batchSizes;
+
+		BatchSystem(BatchEntityRegistry &entityRegistry)
+			: SystemFiller<Reads<BatchComponent>>(System::Phase::Layout)
+			, _entityRegistry(entityRegistry)
+		{
+		}
+
+		void update(const Entity::Identifier &) override
+		{
+		}
+
+		void updateBatch(std::span<const Entity::Identifier> entities) override
+		{
+			batchSizes.push_back(entities.size());
+			if (batchSizes.size() == 1) {
+				_entityRegistry.addEntity(
+					std::make_unique<BatchEntity>(getComponentRegistry()));
+			}
+		}
+	};
+
+	class CounterSystem final:
+		public SystemFiller<Reads<BatchComponent>, Writes<CounterComponent>>
+	{
+		public:
+		CounterSystem(void)
+			: SystemFiller<Reads<BatchComponent>, Writes<CounterComponent>>(
+				  System::Phase::Layout)
+		{
+		}
+
+		void update(const Entity::Identifier &entityIdentifier) override
+		{
+			static_assert(std::is_const_v<std::remove_pointer_t<
+							  decltype(findComponent<BatchComponent>(
+								  entityIdentifier))>>);
+			if (auto *counter =
+					findComponent<CounterComponent>(entityIdentifier)) {
+				++counter->count;
+			}
+		}
+	};
+
+	TEST_F(TestSystem, RoutineHandsMatchingEntitiesAsBatches)
+	{
+		ComponentRegistry componentRegistry;
+		BatchEntityRegistry entityRegistry;
+		for (int index = 0; index < 3; ++index) {
+			entityRegistry.addEntity(
+				std::make_unique<BatchEntity>(componentRegistry));
+		}
+		BatchSystem system(entityRegistry);
+
+		system.routine(componentRegistry, entityRegistry);
+
+		EXPECT_EQ(system.batchSizes, (std::vector<std::size_t> { 3, 1 }));
+	}
+
+	TEST_F(TestSystem, SystemFillerBindsDeclaredStorages)
+	{
+		static_assert(CounterSystem::Accesses<BatchComponent>);
+		static_assert(CounterSystem::Modifies<CounterComponent>);
+		static_assert(!CounterSystem::Modifies<BatchComponent>);
+
+		ComponentRegistry componentRegistry;
+		BatchEntityRegistry entityRegistry;
+		entityRegistry.addEntity(
+			std::make_unique<BatchEntity>(componentRegistry));
+		entityRegistry.addEntity(
+			std::make_unique<BatchEntity>(componentRegistry));
+		CounterSystem system;
+
+		system.routine(componentRegistry, entityRegistry);
+		system.routine(componentRegistry, entityRegistry);
+
+		for (const auto &counter:
+			 componentRegistry.getStorage<CounterComponent>().getComponents()) {
+			EXPECT_EQ(counter.count, 2);
+		}
+	}
+
+	TEST_F(TestSystem, PendingChangesUpdateParentsBeforeChildren)
+	{
+		ComponentRegistry componentRegistry;
+		BatchEntityRegistry entityRegistry;
+		std::vector<Entity::Identifier> updates;
+		auto parent = std::make_unique<OrderedParentEntity>(componentRegistry,
+															 updates);
+		auto child =
+			std::make_unique<OrderedEntity>(componentRegistry, updates);
+		const auto parentIdentifier = parent->getIdentifier();
+		const auto childIdentifier	= child->getIdentifier();
+		parent->addEntity(std::move(child));
+		entityRegistry.addEntity(std::move(parent));
+		componentRegistry.resetChangedFlags();
+
+		componentRegistry.getComponent<CounterComponent>(childIdentifier)
+			.setHasChanged(true);
+		componentRegistry.getComponent<CounterComponent>(parentIdentifier)
+			.setHasChanged(true);
+		System::applyPendingChanges(componentRegistry, entityRegistry);
+
+		EXPECT_EQ(updates, (std::vector<Entity::Identifier> {
+							   parentIdentifier, childIdentifier }));
+		EXPECT_TRUE(componentRegistry.getPendingChanges().empty());
+	}
+
 }	 // namespace guillaume::ecs::tests
\ No newline at end of file
@@ -22,6 +22,83 @@
 
 #include "ecs/test_system_registry.hpp"
 
+#include <atomic>
+#include <memory>
+
+#include <guillaume/ecs/system_filler.hpp>
+#include <guillaume/ecs/system_scheduler.hpp>
+#include <guillaume/ecs/thread_pool.hpp>
+
 namespace guillaume::ecs::tests
 {
+
+	class FirstSchedulerComponent: public Component
+	{
+	};
+
+	class SecondSchedulerComponent: public Component
+	{
+	};
+
+	template<SystemFillerArgument... Arguments> class DummySystem:
+		public SystemFiller<Arguments...>
+	{
+		public:
+		DummySystem(void)
+			: SystemFiller<Arguments...>(System::Phase::Render)
+		{
+		}
+
+		void update(const Entity::Identifier &) override
+		{
+		}
+	};
+
+	TEST_F(TestSystemRegistry, SchedulerGroupsReadersAndOrdersWriters)
+	{
+		using Reader = DummySystem<Reads<FirstSchedulerComponent>>;
+		using Writer = DummySystem<Writes<FirstSchedulerComponent>,
+								   Reads<SecondSchedulerComponent>>;
+
+		SystemRegistry registry;
+		registry.registerNewSystem(std::make_unique<Reader>());
+		registry.registerNewSystem(std::make_unique<Reader>());
+		registry.registerNewSystem(std::make_unique<Writer>());
+		registry.registerNewSystem(
+			std::make_unique<DummySystem<Reads<SecondSchedulerComponent>>>());
+
+		ThreadPool threadPool(2);
+		SystemScheduler scheduler(registry, threadPool);
+		const auto &systems = registry.getSystemsByPhase(System::Phase::Render);
+		const auto &waves	= scheduler.getWaves(System::Phase::Render);
+
+		ASSERT_EQ(waves.size(), 2U);
+		EXPECT_EQ(waves[0], (SystemScheduler::Wave { systems[0].get(),
+													 systems[1].get(),
+													 systems[3].get() }));
+		EXPECT_EQ(waves[1], (SystemScheduler::Wave { systems[2].get() }));
+	}
+
+	TEST_F(TestSystemRegistry, ThreadPoolRunsEveryIndexOnce)
+	{
+		ThreadPool threadPool(3);
+		std::vector<std::atomic<int>> visits(1000);
+
+		threadPool.parallelFor(visits.size(), [&visits](std::size_t index) {
+			++visits[index];
+		});
+
+		for (const auto &visit: visits) {
+			EXPECT_EQ(visit.load(), 1);
+		}
+		EXPECT_THROW(threadPool.parallelFor(
+						 4,
+						 [](std::size_t index) {
+							 if (index == 2) {
+								 throw std::runtime_error("failure");
+							 }
+						 }),
+					 std::runtime_error);
+	}
+
 }	 // namespace guillaume::ecs::tests
\ No newline at end of file
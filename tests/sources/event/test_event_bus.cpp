@@ -22,6 +22,130 @@
 
 #include "event/test_event_bus.hpp"
 
+#include <memory>
+#include <stdexcept>
+
+#include <guillaume/event/event_subscriber.hpp>
+#include <utility/event/keyboard_event.hpp>
+#include <utility/event/mouse_motion_event.hpp>
+#include <utility/event/quit_event.hpp>
+#include <utility/event/text_input_event.hpp>
+
 namespace guillaume::event::tests
 {
+
+	TEST_F(TestEventBus, PublishFansOutToEverySubscriber)
+	{
+		EventBus eventBus;
+		EventSubscriber<utility::event::KeyboardEvent> first(eventBus);
+		EventSubscriber<utility::event::KeyboardEvent> second(eventBus);
+		EventSubscriber<utility::event::TextInputEvent> other(eventBus);
+
+		auto event = std::make_unique<utility::event::KeyboardEvent>();
+		event->setKeycode(utility::event::KeyboardEvent::KeyCode::Backspace);
+		const auto *published = event.get();
+		eventBus.publish(std::move(event));
+
+		const auto firstEvent  = first.getNextEvent();
+		const auto secondEvent = second.getNextEvent();
+		ASSERT_NE(firstEvent, nullptr);
+		EXPECT_EQ(firstEvent.get(), published);
+		EXPECT_EQ(secondEvent.get(), published);
+		EXPECT_EQ(secondEvent->getKeycode(),
+				  utility::event::KeyboardEvent::KeyCode::Backspace);
+		EXPECT_FALSE(other.hasPendingEvents());
+	}
+
+	TEST_F(TestEventBus, UnsubscribedListenersStopReceiving)
+	{
+		EventBus eventBus;
+		int received = 0;
+		const auto subscription =
+			eventBus.subscribe<utility::event::KeyboardEvent>(
+				[&received](const EventBus::EventPointer &) { ++received; });
+		{
+			EventSubscriber<utility::event::KeyboardEvent> scoped(eventBus);
+			eventBus.publish(std::make_unique<utility::event::KeyboardEvent>());
+			EXPECT_TRUE(scoped.hasPendingEvents());
+		}
+		eventBus.publish(std::make_unique<utility::event::KeyboardEvent>());
+		EXPECT_EQ(received, 2);
+
+		EXPECT_TRUE(eventBus.unsubscribe(subscription));
+		EXPECT_FALSE(eventBus.unsubscribe(subscription));
+		eventBus.publish(std::make_unique<utility::event::KeyboardEvent>());
+		EXPECT_EQ(received, 2);
+	}
+
+	TEST_F(TestEventBus, TypesSubscribedLateStillReceiveEvents)
+	{
+		EventBus eventBus;
+		// May be the first use of the type: its lookup misses and is cached.
+		eventBus.publish(std::make_unique<utility::event::QuitEvent>());
+
+		EventSubscriber<utility::event::QuitEvent> subscriber(eventBus);
+		eventBus.publish(std::make_unique<utility::event::QuitEvent>());
+		ASSERT_NE(subscriber.getNextEvent(), nullptr);
+		EXPECT_FALSE(subscriber.hasPendingEvents());
+	}
+
+	/**
+	 * @brief Publish a mouse motion at x.
+	 */
+	static void publishMotion(EventBus &eventBus, float x)
+	{
+		auto event = std::make_unique<utility::event::MouseMotionEvent>();
+		event->setPosition({ x, 0.0f });
+		eventBus.publish(std::move(event));
+	}
+
+	TEST_F(TestEventBus, LatestWinsDeliversLastEventOnFlush)
+	{
+		EventBus eventBus;
+		eventBus.setCoalescingPolicy<utility::event::MouseMotionEvent>(
+			CoalescingPolicy::LatestWins);
+		EventSubscriber<utility::event::MouseMotionEvent> subscriber(eventBus);
+
+		for (int x = 0; x < 100; ++x) {
+			publishMotion(eventBus, static_cast<float>(x));
+		}
+		EXPECT_FALSE(subscriber.hasPendingEvents());
+
+		eventBus.flush();
+		const auto event = subscriber.getNextEvent();
+		ASSERT_NE(event, nullptr);
+		EXPECT_EQ(event->getPosition()[0], 99.0f);
+		EXPECT_FALSE(subscriber.hasPendingEvents());
+
+		eventBus.flush();
+		EXPECT_FALSE(subscriber.hasPendingEvents());
+	}
+
+	TEST_F(TestEventBus, AccumulateMergesEventsUntilFlush)
+	{
+		EventBus eventBus;
+		eventBus.setCoalescingPolicy<utility::event::MouseMotionEvent>(
+			CoalescingPolicy::Accumulate,
+			[](utility::event::MouseMotionEvent &accumulated,
+			   const utility::event::MouseMotionEvent &event) {
+				accumulated.setPosition(accumulated.getPosition()
+										+ event.getPosition());
+			});
+		EventSubscriber<utility::event::MouseMotionEvent> subscriber(eventBus);
+
+		for (const float x: { 1.0f, 2.0f, 3.0f }) {
+			publishMotion(eventBus, x);
+		}
+		eventBus.flush();
+
+		const auto event = subscriber.getNextEvent();
+		ASSERT_NE(event, nullptr);
+		EXPECT_EQ(event->getPosition()[0], 6.0f);
+		EXPECT_FALSE(subscriber.hasPendingEvents());
+		EXPECT_THROW(
+			eventBus.setCoalescingPolicy<utility::event::MouseMotionEvent>(
+				CoalescingPolicy::Accumulate),
+			std::invalid_argument);
+	}
+
 }	 // namespace guillaume::event::tests
\ No newline at end of file
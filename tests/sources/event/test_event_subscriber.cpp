@@ -22,6 +22,96 @@
 
 #include "event/test_event_subscriber.hpp"
 
+#include <algorithm>
+#include <functional>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include <utility/event/mouse_motion_event.hpp>
+
 namespace guillaume::event::tests
 {
+
+	/**
+	 * @brief Publish mouse motions with increasing x from start to end.
+	 */
+	static void publishMotions(EventBus &eventBus, int start, int end)
+	{
+		for (int x = start; x < end; ++x) {
+			auto event = std::make_unique<utility::event::MouseMotionEvent>();
+			event->setPosition({ static_cast<float>(x), 0.0f });
+			eventBus.publish(std::move(event));
+		}
+	}
+
+	/**
+	 * @brief Drain a subscriber and collect the x of each motion.
+	 */
+	static std::vector<int> drainMotions(
+		EventSubscriber<utility::event::MouseMotionEvent> &subscriber)
+	{
+		std::vector<int> positions;
+		while (subscriber.hasPendingEvents()) {
+			positions.push_back(
+				static_cast<int>(subscriber.getNextEvent()->getPosition()[0]));
+		}
+		return positions;
+	}
+
+	TEST_F(TestEventSubscriber, OverflowPolicyChoosesDroppedEvents)
+	{
+		EventBus eventBus;
+		EventSubscriber<utility::event::MouseMotionEvent> dropNewest(
+			eventBus, 4, OverflowPolicy::DropNewest);
+		EventSubscriber<utility::event::MouseMotionEvent> dropOldest(
+			eventBus, 4, OverflowPolicy::DropOldest);
+		EventSubscriber<utility::event::MouseMotionEvent> coalesce(
+			eventBus, 4, OverflowPolicy::Coalesce);
+
+		publishMotions(eventBus, 0, 6);
+
+		EXPECT_EQ(drainMotions(dropNewest), (std::vector<int> { 0, 1, 2, 3 }));
+		EXPECT_EQ(drainMotions(dropOldest), (std::vector<int> { 2, 3, 4, 5 }));
+		EXPECT_EQ(drainMotions(coalesce), (std::vector<int> { 4, 5 }));
+		EXPECT_EQ(dropNewest.getDroppedEventCount(), 2);
+		EXPECT_EQ(dropOldest.getDroppedEventCount(), 2);
+		EXPECT_EQ(coalesce.getDroppedEventCount(), 4);
+	}
+
+	TEST_F(TestEventSubscriber, ConcurrentPublishersLoseNoEvent)
+	{
+		constexpr int ThreadCount	   = 4;
+		constexpr int EventsPerThread = 1000;
+		EventBus eventBus;
+		EventSubscriber<utility::event::MouseMotionEvent> subscriber(
+			eventBus, ThreadCount * EventsPerThread,
+			OverflowPolicy::DropNewest);
+
+		std::vector<std::thread> publishers;
+		for (int thread = 0; thread < ThreadCount; ++thread) {
+			publishers.emplace_back(publishMotions, std::ref(eventBus),
+									thread * EventsPerThread,
+									(thread + 1) * EventsPerThread);
+		}
+		std::vector<int> received;
+		while (received.size() < ThreadCount * EventsPerThread) {
+			if (const auto event = subscriber.getNextEvent()) {
+				received.push_back(
+					static_cast<int>(event->getPosition()[0]));
+			}
+		}
+		for (auto &publisher: publishers) {
+			publisher.join();
+		}
+
+		std::vector<bool> seen(ThreadCount * EventsPerThread, false);
+		for (const int x: received) {
+			seen[static_cast<std::size_t>(x)] = true;
+		}
+		EXPECT_EQ(std::count(seen.begin(), seen.end(), true),
+				  ThreadCount * EventsPerThread);
+		EXPECT_EQ(subscriber.getDroppedEventCount(), 0);
+	}
+
 }	 // namespace guillaume::event::tests
\ No newline at end of file
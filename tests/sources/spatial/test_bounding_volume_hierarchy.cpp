@@ -0,0 +1,138 @@
+/*
+ Copyright (c) 2026 ETIB Corporation
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy of
+ this software and associated documentation files (the "Software"), to deal in
+ the Software without restriction, including without limitation the rights to
+ use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ of the Software, and to permit persons to whom the Software is furnished to do
+ so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in all
+ copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ SOFTWARE.
+ */
+
+#include "spatial/test_bounding_volume_hierarchy.hpp"
+
+#include <cmath>
+#include <limits>
+#include <optional>
+#include <random>
+#include <vector>
+
+namespace guillaume::spatial::tests
+{
+
+	/**
+	 * @brief Build a ray looking down -z from above a point.
+	 */
+	static utility::graphic::RayF makeDownwardRay(float x, float y)
+	{
+		return utility::graphic::RayF(
+			utility::graphic::PositionF(x, y, 100.0f),
+			utility::math::Vector3F({ 0.0f, 0.0f, -1.0f }));
+	}
+
+	TEST_F(TestBoundingVolumeHierarchy, NearestPanelAlongTheRayWins)
+	{
+		BoundingVolumeHierarchy hierarchy;
+		for (std::size_t layer = 0; layer < 3; ++layer) {
+			hierarchy.insert(
+				layer,
+				OrientedRectangle(utility::graphic::PositionF(
+									  0.0f, 0.0f, static_cast<float>(layer)),
+								  utility::graphic::OrientationF(), 10.0f,
+								  10.0f));
+		}
+
+		auto hit = hierarchy.intersectNearest(makeDownwardRay(1.0f, 1.0f));
+		ASSERT_TRUE(hit.has_value());
+		EXPECT_EQ(hit->identifier, 2U);
+		EXPECT_FLOAT_EQ(hit->distance, 98.0f);
+
+		// Moving the top panel away refits the tree.
+		hierarchy.insert(
+			2, OrientedRectangle(utility::graphic::PositionF(50.0f, 0.0f, 2.0f),
+								 utility::graphic::OrientationF(), 10.0f,
+								 10.0f));
+		hit = hierarchy.intersectNearest(makeDownwardRay(1.0f, 1.0f));
+		ASSERT_TRUE(hit.has_value());
+		EXPECT_EQ(hit->identifier, 1U);
+
+		EXPECT_TRUE(hierarchy.remove(1));
+		hit = hierarchy.intersectNearest(makeDownwardRay(1.0f, 1.0f));
+		ASSERT_TRUE(hit.has_value());
+		EXPECT_EQ(hit->identifier, 0U);
+		EXPECT_FALSE(
+			hierarchy.intersectNearest(makeDownwardRay(20.0f, 1.0f)));
+	}
+
+	TEST_F(TestBoundingVolumeHierarchy, PacketsMatchTestingEveryPanel)
+	{
+		std::mt19937 generator(42);
+		std::uniform_real_distribution<float> coordinate(-100.0f, 100.0f);
+		std::uniform_real_distribution<float> component(-1.0f, 1.0f);
+
+		BoundingVolumeHierarchy hierarchy;
+		std::vector<OrientedRectangle> rectangles;
+		for (std::size_t index = 0; index < 500; ++index) {
+			utility::graphic::OrientationF orientation(
+				component(generator), component(generator),
+				component(generator), 1.0f);
+			const float length =
+				std::sqrt((orientation.x * orientation.x)
+						  + (orientation.y * orientation.y)
+						  + (orientation.z * orientation.z) + 1.0f);
+			orientation = utility::graphic::OrientationF(
+				orientation.x / length, orientation.y / length,
+				orientation.z / length, 1.0f / length);
+			rectangles.emplace_back(
+				utility::graphic::PositionF(coordinate(generator),
+											coordinate(generator),
+											coordinate(generator)),
+				orientation, 20.0f, 10.0f);
+			hierarchy.insert(index, rectangles.back());
+		}
+
+		std::vector<utility::graphic::RayF> rays;
+		for (std::size_t index = 0; index < 37; ++index) {
+			rays.emplace_back(
+				utility::graphic::PositionF(coordinate(generator),
+											coordinate(generator), 150.0f),
+				utility::math::Vector3F({ component(generator) / 2.0f,
+										  component(generator) / 2.0f,
+										  -1.0f }));
+		}
+		std::vector<std::optional<RayHit>> hits(rays.size());
+		hierarchy.intersectNearest(rays, hits);
+
+		std::size_t hitCount = 0;
+		for (std::size_t ray = 0; ray < rays.size(); ++ray) {
+			float nearest = std::numeric_limits<float>::max();
+			std::optional<std::size_t> expected;
+			for (std::size_t index = 0; index < rectangles.size(); ++index) {
+				float distance = 0.0f;
+				if (rectangles[index].intersect(rays[ray], nearest,
+												distance)) {
+					nearest	 = distance;
+					expected = index;
+				}
+			}
+			ASSERT_EQ(hits[ray].has_value(), expected.has_value());
+			if (expected) {
+				++hitCount;
+				EXPECT_FLOAT_EQ(hits[ray]->distance, nearest);
+			}
+		}
+		EXPECT_GT(hitCount, 0U);
+	}
+
+}	 // namespace guillaume::spatial::tests
\ No newline at end of file
@@ -0,0 +1,111 @@
+/*
+ Copyright (c) 2026 ETIB Corporation
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy of
+ this software and associated documentation files (the "Software"), to deal in
+ the Software without restriction, including without limitation the rights to
+ use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ of the Software, and to permit persons to whom the Software is furnished to do
+ so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in all
+ copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ SOFTWARE.
+ */
+
+#include "spatial/test_uniform_grid.hpp"
+
+#include <cmath>
+#include <vector>
+
+namespace guillaume::spatial::tests
+{
+
+	/**
+	 * @brief Build an unrotated rectangle around a center.
+	 */
+	static OrientedRectangle makeRectangle(float x, float y, float width,
+										   float height)
+	{
+		return OrientedRectangle(utility::graphic::PositionF(x, y, 0.0f),
+								 utility::graphic::OrientationF(), width,
+								 height);
+	}
+
+	TEST_F(TestUniformGrid, QueryPointFindsContainingRectangles)
+	{
+		UniformGrid grid;
+		grid.insert(3, makeRectangle(0.0f, 0.0f, 100.0f, 50.0f));
+		grid.insert(1, makeRectangle(500.0f, 500.0f, 20.0f, 20.0f));
+		grid.insert(2, makeRectangle(0.0f, 0.0f, 10000.0f, 10000.0f));
+
+		std::vector<UniformGrid::Identifier> hits;
+		grid.queryPoint(utility::math::Vector2F({ 10.0f, 10.0f }), hits);
+		EXPECT_EQ(hits, (std::vector<UniformGrid::Identifier> { 2, 3 }));
+
+		grid.queryPoint(utility::math::Vector2F({ 505.0f, 495.0f }), hits);
+		EXPECT_EQ(hits, (std::vector<UniformGrid::Identifier> { 1, 2 }));
+
+		grid.queryPoint(utility::math::Vector2F({ 60.0f, 0.0f }), hits);
+		EXPECT_EQ(hits, (std::vector<UniformGrid::Identifier> { 2 }));
+	}
+
+	TEST_F(TestUniformGrid, MovedAndRemovedRectanglesAreRelinked)
+	{
+		UniformGrid grid;
+		std::vector<UniformGrid::Identifier> hits;
+		grid.insert(7, makeRectangle(0.0f, 0.0f, 20.0f, 20.0f));
+		grid.insert(7, makeRectangle(1000.0f, 0.0f, 20.0f, 20.0f));
+		EXPECT_EQ(grid.size(), 1U);
+
+		grid.queryPoint(utility::math::Vector2F({ 0.0f, 0.0f }), hits);
+		EXPECT_TRUE(hits.empty());
+		grid.queryPoint(utility::math::Vector2F({ 1005.0f, 5.0f }), hits);
+		EXPECT_EQ(hits, (std::vector<UniformGrid::Identifier> { 7 }));
+
+		EXPECT_TRUE(grid.remove(7));
+		EXPECT_FALSE(grid.remove(7));
+		grid.queryPoint(utility::math::Vector2F({ 1005.0f, 5.0f }), hits);
+		EXPECT_TRUE(hits.empty());
+	}
+
+	TEST_F(TestUniformGrid, RotatedRectanglesUseTheirProjection)
+	{
+		const float halfSine = std::sqrt(0.5f);
+		// A quarter turn around z swaps the width and height on screen.
+		const OrientedRectangle turned(
+			utility::graphic::PositionF(0.0f, 0.0f, 0.0f),
+			utility::graphic::OrientationF(0.0f, 0.0f, halfSine, halfSine),
+			100.0f, 10.0f);
+		EXPECT_TRUE(
+			turned.containsProjected(utility::math::Vector2F({ 0.0f, 40.0f })));
+		EXPECT_FALSE(
+			turned.containsProjected(utility::math::Vector2F({ 40.0f, 0.0f })));
+
+		// A quarter turn around y shows the rectangle edge-on.
+		const OrientedRectangle edgeOn(
+			utility::graphic::PositionF(0.0f, 0.0f, 0.0f),
+			utility::graphic::OrientationF(0.0f, halfSine, 0.0f, halfSine),
+			100.0f, 10.0f);
+		EXPECT_FALSE(
+			edgeOn.containsProjected(utility::math::Vector2F({ 0.0f, 0.0f })));
+
+		// Entity poses anchor the top edge, as drawn by RectangleRender.
+		const auto drawn = OrientedRectangle::fromPose(
+			utility::graphic::PoseF(
+				utility::graphic::PositionF(0.0f, 0.0f, 0.0f)),
+			100.0f, 50.0f);
+		EXPECT_TRUE(
+			drawn.containsProjected(utility::math::Vector2F({ 0.0f, -40.0f })));
+		EXPECT_FALSE(
+			drawn.containsProjected(utility::math::Vector2F({ 0.0f, 10.0f })));
+	}
+
+}	 // namespace guillaume::spatial::tests
\ No newline at end of file
@@ -20,8 +20,265 @@
  SOFTWARE.
  */
 
+#include <memory>
+#include <vector>
+
+#include <utility/event/mouse_button_event.hpp>
+#include <utility/event/mouse_motion_event.hpp>
+#include <utility/graphic/pose.hpp>
+#include <utility/graphic/position.hpp>
+
+#include "guillaume/components/bound.hpp"
+#include "guillaume/components/interaction.hpp"
+#include "guillaume/components/transform.hpp"
+#include "guillaume/ecs/component_registry.hpp"
+#include "guillaume/ecs/entity_registry_container.hpp"
+#include "guillaume/ecs/parent_entity.hpp"
+#include "guillaume/event/event_bus.hpp"
+
 #include "systems/test_interaction.hpp"
 
+namespace
+{
+	class RendererStub: public guillaume::Renderer
+	{
+		public:
+		ViewportSize getViewportSize(void) const override
+		{
+			return { 800.0f, 600.0f };
+		}
+		void clear(void) override
+		{
+		}
+		void present(void) override
+		{
+		}
+		void drawVertices(
+			const std::vector<utility::graphic::VertexF> &vertices) override
+		{
+			(void)vertices;
+		}
+		utility::math::Vector<float, 2>
+			measureText(const utility::graphic::Text &text) override
+		{
+			(void)text;
+			return { 0.0f, 0.0f };
+		}
+		void drawText(const utility::graphic::Text &text,
+					  const utility::graphic::PoseF &pose) override
+		{
+			(void)text;
+			(void)pose;
+		}
+	};
+
+	class InteractionFixture:
+		public guillaume::systems::tests::TestInteraction
+	{
+		protected:
+		RendererStub renderer;
+		guillaume::event::EventBus eventBus;
+		guillaume::systems::Interaction interactionSystem { eventBus,
+															renderer };
+		guillaume::ecs::ComponentRegistry componentRegistry;
+		guillaume::ecs::EntityRegistryContainer entityRegistry;
+		std::vector<std::string> transitions;
+
+		/**
+		 * @brief Add a 10x10 interactive square centered on (x, 0).
+		 */
+		guillaume::ecs::Entity::Identifier addSquare(const std::string &name,
+													 float x)
+		{
+			auto entity = std::make_unique<guillaume::ecs::Entity>();
+			const auto entityIdentifier = entity->getIdentifier();
+			entityRegistry.addEntity(std::move(entity));
+			makeSquare(entityIdentifier, name, x);
+			return entityIdentifier;
+		}
+
+		/**
+		 * @brief Make an added entity a 10x10 interactive square centered on
+		 * (x, 0).
+		 */
+		void makeSquare(guillaume::ecs::Entity::Identifier entityIdentifier,
+						const std::string &name, float x)
+		{
+			entityRegistry.findEntity(entityIdentifier)
+				->setSignature(guillaume::ecs::Entity::getSignatureFromTypes<
+							   guillaume::components::Interaction,
+							   guillaume::components::Transform,
+							   guillaume::components::Bound>());
+
+			componentRegistry
+				.addComponent<guillaume::components::Transform>(
+					entityIdentifier)
+				.setPose(utility::graphic::PoseF(
+					utility::graphic::PositionF(x, 5.0f, 0.0f)));
+			componentRegistry
+				.addComponent<guillaume::components::Bound>(entityIdentifier)
+				.setWidth(10)
+				.setHeight(10);
+			auto &interaction =
+				componentRegistry
+					.addComponent<guillaume::components::Interaction>(
+						entityIdentifier);
+			interaction.setMouseOnHoverHandler(
+				[this, name] { transitions.push_back("hover " + name); });
+			interaction.setMouseOnUnhoverHandler(
+				[this, name] { transitions.push_back("unhover " + name); });
+			interaction.setMouseButtonOnClickHandler(
+				utility::event::MouseButtonEvent::Button::Left,
+				[this, name] { transitions.push_back("click " + name); });
+		}
+
+		void moveMouse(float x, float y)
+		{
+			auto event = std::make_unique<utility::event::MouseMotionEvent>();
+			event->setPosition({ x, y });
+			eventBus.publish(std::move(event));
+			interactionSystem.routine(componentRegistry, entityRegistry);
+			componentRegistry.advanceFrame();
+		}
+
+		void pressLeftButton(bool isPressed)
+		{
+			auto event = std::make_unique<utility::event::MouseButtonEvent>();
+			guillaume::components::Interaction::MouseButtons buttons;
+			buttons.set(static_cast<std::size_t>(
+							utility::event::MouseButtonEvent::Button::Left),
+						isPressed);
+			event->setButtonsState(buttons);
+			eventBus.publish(std::move(event));
+			interactionSystem.routine(componentRegistry, entityRegistry);
+			componentRegistry.advanceFrame();
+		}
+	};
+
+}	 // namespace
+
 namespace guillaume::systems::tests
 {
+
+	TEST_F(InteractionFixture, OnlyEntitiesLeftOrEnteredByThePointerChange)
+	{
+		addSquare("left", 0.0f);
+		addSquare("right", 100.0f);
+		addSquare("idle", 200.0f);
+
+		moveMouse(1.0f, 1.0f);
+		moveMouse(2.0f, 2.0f);
+		moveMouse(99.0f, 0.0f);
+		moveMouse(50.0f, 50.0f);
+
+		const std::vector<std::string> expected = {
+			"hover left", "unhover left", "hover right", "unhover right"
+		};
+		EXPECT_EQ(transitions, expected);
+	}
+
+	TEST_F(InteractionFixture, DestroyedHoveredEntityIsForgotten)
+	{
+		const auto hovered = addSquare("hovered", 0.0f);
+
+		moveMouse(0.0f, 0.0f);
+		entityRegistry.destroyEntity(hovered, componentRegistry);
+		moveMouse(50.0f, 50.0f);
+
+		const std::vector<std::string> expected = { "hover hovered" };
+		EXPECT_EQ(transitions, expected);
+	}
+
+	TEST_F(InteractionFixture, EntitiesAddedOrReplacedLaterAreHit)
+	{
+		const auto first = addSquare("first", 0.0f);
+		moveMouse(50.0f, 50.0f);
+
+		entityRegistry.destroyEntity(first, componentRegistry);
+		addSquare("second", 0.0f);
+		moveMouse(0.0f, 0.0f);
+
+		auto entity = std::make_unique<guillaume::ecs::Entity>();
+		const auto bare = entity->getIdentifier();
+		entity->setSignature(guillaume::ecs::Entity::getSignatureFromTypes<
+							 guillaume::components::Interaction,
+							 guillaume::components::Transform,
+							 guillaume::components::Bound>());
+		entityRegistry.addEntity(std::move(entity));
+		componentRegistry.addComponent<guillaume::components::Transform>(bare)
+			.setPose(utility::graphic::PoseF(
+				utility::graphic::PositionF(100.0f, 5.0f, 0.0f)));
+		componentRegistry.addComponent<guillaume::components::Bound>(bare)
+			.setWidth(10)
+			.setHeight(10);
+		moveMouse(50.0f, 50.0f);
+		moveMouse(50.0f, 50.0f);
+
+		// Only the Interaction change log mentions the entity from now on.
+		componentRegistry.addComponent<guillaume::components::Interaction>(
+			bare);
+		moveMouse(100.0f, 0.0f);
+
+		const std::vector<std::string> expected = { "hover second",
+													"unhover second" };
+		EXPECT_EQ(transitions, expected);
+		EXPECT_TRUE(componentRegistry
+						.getComponent<guillaume::components::Interaction>(bare)
+						.isMouseHovered());
+	}
+
+	TEST_F(InteractionFixture, OnlyTheTopmostOverlappingEntityIsHit)
+	{
+		// The button is created first but painted over its panel.
+		auto button = std::make_unique<guillaume::ecs::Entity>();
+		auto panel	= std::make_unique<guillaume::ecs::ParentEntity>();
+		const auto buttonIdentifier = button->getIdentifier();
+		const auto panelIdentifier	= panel->getIdentifier();
+		panel->addEntity(std::move(button));
+		entityRegistry.addEntity(std::move(panel));
+		makeSquare(panelIdentifier, "panel", 0.0f);
+		makeSquare(buttonIdentifier, "button", 0.0f);
+
+		moveMouse(0.0f, 0.0f);
+		pressLeftButton(true);
+		pressLeftButton(false);
+		moveMouse(50.0f, 50.0f);
+
+		const std::vector<std::string> expected = { "hover button",
+													"click button",
+													"unhover button" };
+		EXPECT_EQ(transitions, expected);
+	}
+
+	TEST_F(InteractionFixture, ClickFiresOncePerPressAndReleaseInside)
+	{
+		const auto square = addSquare("square", 0.0f);
+		componentRegistry
+			.getComponent<guillaume::components::Interaction>(square)
+			.setMouseButtonOnClickHandler(
+				utility::event::MouseButtonEvent::Button::Left,
+				[this] { transitions.push_back("click"); })
+			.setMouseButtonOnClickReleaseHandler(
+				utility::event::MouseButtonEvent::Button::Left,
+				[this] { transitions.push_back("release"); });
+
+		moveMouse(0.0f, 0.0f);
+		pressLeftButton(true);
+		moveMouse(1.0f, 0.0f);
+		pressLeftButton(false);
+		pressLeftButton(true);
+		moveMouse(50.0f, 50.0f);
+		pressLeftButton(false);
+
+		const std::vector<std::string> expected = {
+			"hover square", "click", "release", "click", "unhover square"
+		};
+		EXPECT_EQ(transitions, expected);
+		EXPECT_FALSE(componentRegistry
+						 .getComponent<guillaume::components::Interaction>(
+							 square)
+						 .getMouseButtonsClicked()
+						 .any());
+	}
+
 }	 // namespace guillaume::systems::tests
\ No newline at end of file
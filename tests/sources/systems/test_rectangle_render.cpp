@@ -0,0 +1,154 @@
+/*
+ Copyright (c) 2026 ETIB Corporation
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy of
+ this software and associated documentation files (the "Software"), to deal in
+ the Software without restriction, including without limitation the rights to
+ use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ of the Software, and to permit persons to whom the Software is furnished to do
+ so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in all
+ copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ SOFTWARE.
+ */
+
+#include <memory>
+#include <span>
+#include <vector>
+
+#include <utility/graphic/pose.hpp>
+#include <utility/graphic/position.hpp>
+
+#include "guillaume/components/borders.hpp"
+#include "guillaume/components/bound.hpp"
+#include "guillaume/components/color.hpp"
+#include "guillaume/components/transform.hpp"
+#include "guillaume/ecs/component_registry.hpp"
+#include "guillaume/ecs/entity_registry_container.hpp"
+
+#include "systems/test_rectangle_render.hpp"
+
+namespace
+{
+	class RendererStub: public guillaume::Renderer
+	{
+		public:
+		std::size_t fans = 0;
+		std::vector<std::vector<utility::graphic::VertexF>> batches;
+
+		ViewportSize getViewportSize(void) const override
+		{
+			return { 800.0f, 600.0f };
+		}
+		void clear(void) override
+		{
+		}
+		void present(void) override
+		{
+		}
+		void drawVertices(
+			const std::vector<utility::graphic::VertexF> &vertices) override
+		{
+			(void)vertices;
+			++fans;
+		}
+		void drawTriangles(
+			std::span<const utility::graphic::VertexF> vertices,
+			std::span<const guillaume::RenderCommandList::Index> indices)
+			override
+		{
+			(void)indices;
+			batches.emplace_back(vertices.begin(), vertices.end());
+		}
+		utility::math::Vector<float, 2>
+			measureText(const utility::graphic::Text &text) override
+		{
+			(void)text;
+			return { 0.0f, 0.0f };
+		}
+		void drawText(const utility::graphic::Text &text,
+					  const utility::graphic::PoseF &pose) override
+		{
+			(void)text;
+			(void)pose;
+		}
+	};
+
+	class RectangleRenderFixture:
+		public guillaume::systems::tests::TestRectangleRender
+	{
+		protected:
+		RendererStub renderer;
+		guillaume::systems::RectangleRender rectangleRenderSystem {
+			renderer
+		};
+		guillaume::ecs::ComponentRegistry componentRegistry;
+		guillaume::ecs::EntityRegistryContainer entityRegistry;
+
+		/**
+		 * @brief Add a 10x10 rectangle whose top center is (x, 0).
+		 */
+		void addRectangle(float x)
+		{
+			auto entity = std::make_unique<guillaume::ecs::Entity>();
+			const auto entityIdentifier = entity->getIdentifier();
+			entity->setSignature(guillaume::ecs::Entity::getSignatureFromTypes<
+								 guillaume::components::Transform,
+								 guillaume::components::Bound,
+								 guillaume::components::Color,
+								 guillaume::components::Borders>());
+			entityRegistry.addEntity(std::move(entity));
+
+			componentRegistry
+				.addComponent<guillaume::components::Transform>(
+					entityIdentifier)
+				.setPose(utility::graphic::PoseF(
+					utility::graphic::PositionF(x, 0.0f, 0.0f)));
+			componentRegistry
+				.addComponent<guillaume::components::Bound>(entityIdentifier)
+				.setWidth(10)
+				.setHeight(10);
+			componentRegistry.addComponent<guillaume::components::Color>(
+				entityIdentifier);
+			componentRegistry.addComponent<guillaume::components::Borders>(
+				entityIdentifier);
+		}
+	};
+
+}	 // namespace
+
+namespace guillaume::systems::tests
+{
+
+	TEST_F(RectangleRenderFixture, RectanglesAreAppendedToTheCommandList)
+	{
+		addRectangle(10.0f);
+		addRectangle(300.0f);
+
+		renderer.beginFrame();
+		rectangleRenderSystem.routine(componentRegistry, entityRegistry);
+		EXPECT_TRUE(renderer.batches.empty());
+		renderer.endFrame();
+
+		EXPECT_EQ(renderer.fans, 0U);
+		ASSERT_EQ(renderer.batches.size(), 1U);
+		EXPECT_EQ(renderer.getFrameStatistics().drawCalls, 1U);
+
+		// Each fan starts with the center of its rectangle, in entity order.
+		const auto &vertices = renderer.batches.front();
+		ASSERT_FALSE(vertices.empty());
+		ASSERT_EQ(vertices.size() % 2, 0U);
+		EXPECT_FLOAT_EQ(vertices.front().getPosition()[0], 10.0f);
+		EXPECT_FLOAT_EQ(vertices[vertices.size() / 2].getPosition()[0],
+						300.0f);
+	}
+
+}	 // namespace guillaume::systems::tests
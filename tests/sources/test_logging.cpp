@@ -0,0 +1,88 @@
+/*
+ Copyright (c) 2026 ETIB Corporation
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy of
+ this software and associated documentation files (the "Software"), to deal in
+ the Software without restriction, including without limitation the rights to
+ use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ of the Software, and to permit persons to whom the Software is furnished to do
+ so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in all
+ copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ SOFTWARE.
+ */
+
+#include "test_logging.hpp"
+
+#include <string>
+#include <vector>
+
+namespace guillaume::tests
+{
+
+	struct RecordingLogger {
+		std::vector<std::string> messages;
+
+		void debug(const std::string &message)
+		{
+			messages.push_back("debug: " + message);
+		}
+
+		void info(const std::string &message)
+		{
+			messages.push_back("info: " + message);
+		}
+
+		void warning(const std::string &message)
+		{
+			messages.push_back("warning: " + message);
+		}
+
+		void error(const std::string &message)
+		{
+			messages.push_back("error: " + message);
+		}
+	};
+
+	TEST_F(TestLogging, DisabledLevelSkipsFormatting)
+	{
+		RecordingLogger logger;
+		int formatted = 0;
+		logging::setLevel(logging::Level::Info);
+
+		logging::debug(logger, [&formatted] {
+			++formatted;
+			return std::string("hidden");
+		});
+		logging::info(logger, [&formatted] {
+			++formatted;
+			return std::string("shown");
+		});
+
+		EXPECT_EQ(formatted, 1);
+		EXPECT_EQ(logger.messages,
+				  (std::vector<std::string> { "info: shown" }));
+	}
+
+	TEST_F(TestLogging, EnabledLevelRoutesToLogger)
+	{
+		RecordingLogger logger;
+		logging::setLevel(logging::Level::Debug);
+
+		logging::debug(logger, [] { return "trace"; });
+		logging::write<logging::Level::Error>(logger, [] { return "failed"; });
+
+		EXPECT_TRUE(logging::isEnabled<logging::Level::Debug>());
+		EXPECT_EQ(logger.messages, (std::vector<std::string> {
+									   "debug: trace", "error: failed" }));
+	}
+
+}	 // namespace guillaume::tests
\ No newline at end of file
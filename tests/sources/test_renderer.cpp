@@ -20,8 +20,176 @@
  SOFTWARE.
  */
 
+#include <vector>
+
+#include <utility/graphic/color.hpp>
+#include <utility/graphic/position.hpp>
+
 #include "test_renderer.hpp"
 
+namespace
+{
+	class RendererStub: public guillaume::Renderer
+	{
+		public:
+		std::size_t triangleBatches = 0;
+		std::size_t fans			= 0;
+
+		ViewportSize getViewportSize(void) const override
+		{
+			return { 800.0f, 600.0f };
+		}
+		void clear(void) override
+		{
+		}
+		void present(void) override
+		{
+		}
+		void drawVertices(
+			const std::vector<utility::graphic::VertexF> &vertices) override
+		{
+			(void)vertices;
+			++fans;
+		}
+		void drawTriangles(
+			std::span<const utility::graphic::VertexF> vertices,
+			std::span<const guillaume::RenderCommandList::Index> indices)
+			override
+		{
+			(void)vertices;
+			(void)indices;
+			++triangleBatches;
+		}
+		utility::math::Vector<float, 2>
+			measureText(const utility::graphic::Text &text) override
+		{
+			(void)text;
+			return { 0.0f, 0.0f };
+		}
+		void drawText(const utility::graphic::Text &text,
+					  const utility::graphic::PoseF &pose) override
+		{
+			(void)text;
+			(void)pose;
+		}
+	};
+
+	/**
+	 * @brief Renderer relying on the default drawTriangles().
+	 */
+	class FallbackRendererStub: public guillaume::Renderer
+	{
+		public:
+		std::vector<std::vector<utility::graphic::VertexF>> fans;
+
+		ViewportSize getViewportSize(void) const override
+		{
+			return { 800.0f, 600.0f };
+		}
+		void clear(void) override
+		{
+		}
+		void present(void) override
+		{
+		}
+		void drawVertices(
+			const std::vector<utility::graphic::VertexF> &vertices) override
+		{
+			fans.push_back(vertices);
+		}
+		utility::math::Vector<float, 2>
+			measureText(const utility::graphic::Text &text) override
+		{
+			(void)text;
+			return { 0.0f, 0.0f };
+		}
+		void drawText(const utility::graphic::Text &text,
+					  const utility::graphic::PoseF &pose) override
+		{
+			(void)text;
+			(void)pose;
+		}
+	};
+
+	/**
+	 * @brief Build a fan of the given number of vertices.
+	 */
+	std::vector<utility::graphic::VertexF> makeFan(std::size_t count)
+	{
+		std::vector<utility::graphic::VertexF> fan(count);
+		for (std::size_t index = 0; index < count; ++index) {
+			fan[index].setPosition(utility::graphic::PositionF(
+				static_cast<float>(index), 0.0f, 0.0f));
+		}
+		return fan;
+	}
+
+}	 // namespace
+
 namespace guillaume::tests
 {
-}	 // namespace guillaume::tests
\ No newline at end of file
+
+	TEST_F(TestRenderer, FansBecomeIndexedTrianglesInOrder)
+	{
+		RenderCommandList commandList;
+
+		commandList.appendTriangleFan(makeFan(4));
+		commandList.appendTriangleFan(makeFan(2));
+		commandList.appendTriangleFan(makeFan(3));
+
+		const std::vector<RenderCommandList::Index> expected = { 0, 1, 2, 0,
+																 2, 3, 4, 5,
+																 6 };
+		EXPECT_EQ(commandList.getIndices(), expected);
+		EXPECT_EQ(commandList.getVertices().size(), 7U);
+
+		commandList.clear();
+		EXPECT_TRUE(commandList.empty());
+	}
+
+	TEST_F(TestRenderer, FrameGeometryIsDrawnInOneBatchPerFlush)
+	{
+		RendererStub renderer;
+
+		renderer.beginFrame();
+		for (std::size_t shape = 0; shape < 100; ++shape) {
+			renderer.getCommandList().appendTriangleFan(makeFan(6));
+		}
+		renderer.flush();
+		renderer.getCommandList().appendTriangleFan(makeFan(3));
+		renderer.endFrame();
+
+		EXPECT_EQ(renderer.triangleBatches, 2U);
+		EXPECT_EQ(renderer.fans, 0U);
+		EXPECT_EQ(renderer.getFrameStatistics().drawCalls, 2U);
+		EXPECT_EQ(renderer.getFrameStatistics().vertices, (100U * 12U) + 3U);
+
+		renderer.beginFrame();
+		renderer.endFrame();
+		EXPECT_EQ(renderer.getFrameStatistics().drawCalls, 0U);
+	}
+
+	TEST_F(TestRenderer, DefaultDrawTrianglesDrawsOneFanPerShape)
+	{
+		FallbackRendererStub renderer;
+
+		renderer.beginFrame();
+		renderer.getCommandList().appendTriangleFan(makeFan(6));
+		renderer.getCommandList().appendTriangleFan(makeFan(3));
+		renderer.getCommandList().appendTriangleFan(makeFan(4));
+		renderer.endFrame();
+
+		ASSERT_EQ(renderer.fans.size(), 3U);
+		EXPECT_EQ(renderer.fans[0].size(), 6U);
+		EXPECT_EQ(renderer.fans[1].size(), 3U);
+		EXPECT_EQ(renderer.fans[2].size(), 4U);
+		for (std::size_t index = 0; index < renderer.fans[0].size();
+			 ++index) {
+			EXPECT_EQ(renderer.fans[0][index].getPosition()[0],
+					  static_cast<float>(index));
+		}
+		EXPECT_EQ(renderer.getFrameStatistics().drawCalls, 3U);
+		EXPECT_EQ(renderer.getFrameStatistics().vertices, 12U + 3U + 6U);
+	}
+
+}	 // namespace guillaume::tests
@@ -0,0 +1,87 @@
+/*
+ Copyright (c) 2026 ETIB Corporation
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy of
+ this software and associated documentation files (the "Software"), to deal in
+ the Software without restriction, including without limitation the rights to
+ use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ of the Software, and to permit persons to whom the Software is furnished to do
+ so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in all
+ copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ SOFTWARE.
+ */
+
+#include <array>
+#include <functional>
+#include <memory>
+#include <numeric>
+#include <utility>
+
+#include "test_small_function.hpp"
+
+namespace guillaume::tests
+{
+
+	TEST_F(TestSmallFunction, SmallCallablesAreStoredInPlace)
+	{
+		static_assert(sizeof(SmallFunction<void(void)>)
+						  == 3 * sizeof(void *),
+					  "two pointers of storage and one of operations");
+
+		int calls = 0;
+		SmallFunction<int(int)> function = [&calls](int value) {
+			++calls;
+			return value * 2;
+		};
+		const auto copy = function;
+		auto moved		= std::move(function);
+
+		EXPECT_FALSE(function);
+		EXPECT_EQ(copy(2), 4);
+		EXPECT_EQ(moved(3), 6);
+		EXPECT_EQ(calls, 2);
+
+		moved = nullptr;
+		EXPECT_FALSE(moved);
+		EXPECT_THROW(moved(1), std::bad_function_call);
+	}
+
+	TEST_F(TestSmallFunction, LargeCallablesAreAllocatedAndOwned)
+	{
+		std::array<int, 16> values {};
+		std::iota(values.begin(), values.end(), 1);
+		const auto tracker = std::make_shared<int>(0);
+
+		SmallFunction<int(void)> function = [values, tracker] {
+			return std::accumulate(values.begin(), values.end(), 0);
+		};
+		auto copy = function;
+		EXPECT_EQ(tracker.use_count(), 3);
+		EXPECT_EQ(function(), 136);
+
+		function = nullptr;
+		EXPECT_EQ(tracker.use_count(), 2);
+		EXPECT_EQ(copy(), 136);
+		copy = SmallFunction<int(void)>();
+		EXPECT_EQ(tracker.use_count(), 1);
+	}
+
+	TEST_F(TestSmallFunction, EmptyCallablesGiveEmptyFunctions)
+	{
+		const std::function<void(void)> empty;
+		void (*const nullPointer)(void) = nullptr;
+
+		EXPECT_FALSE(SmallFunction<void(void)>(empty));
+		EXPECT_FALSE(SmallFunction<void(void)>(nullPointer));
+	}
+
+}	 // namespace guillaume::tests
\ No newline at end of file